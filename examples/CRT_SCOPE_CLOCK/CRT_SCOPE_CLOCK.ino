@@ -155,8 +155,8 @@ bool Gbl_StartUp_In_Clock_Mode = true;	//Set this 'true' to auto=start into CLOC
 //DEFINE Global (Gbl) Variables used to draw the clock features
 //	These global variables are used to control CLOCK coordinates, size, etc.										
 float Gbl_X_Center, Gbl_Y_Center, Gbl_X_FaceRadius, Gbl_Y_FaceRadius, Gbl_Center_Radius, Gbl_MinHubCenterRadius;
-float Gbl_Hour_HandLength,Gbl_Hour_EndRadius, Gbl_Hour_End_X_Center, Gbl_Hour_End_Y_Center;
-float Gbl_Min_HandLength, Gbl_Min_EndRadius, Gbl_Min_End_X_Center, Gbl_Min_End_Y_Center;
+float Gbl_Hour_HandLength,Gbl_Hour_EndRadius;
+float Gbl_Min_HandLength, Gbl_Min_EndRadius;
 float Gbl_Sec_HandLength, Gbl_Sec_End_X, Gbl_Sec_End_Y;
 //These are used for storing XYlist pointers to the start of the HR, Min, and Sec hands
 int Gbl_HR_ListPtr, Gbl_MIN_ListPtr, Gbl_SEC_ListPtr;
@@ -201,18 +201,18 @@ time_t t;					//Define 't' as a 'time_t' data type (time_t data structure is def
 		//	Define structure for timing-setup data that is held in EEPROM; If we're on the DUE platform, skip it!
 		struct EEpromData_1 {
 			float DataStructRev;			//Data structure revision designation
-			int	PioSmallSettleCount; 		//Defines Small Step Settling time delay (where n=Num of NOP instructions)
-			int	PioLargeSettleCount; 		//Defines Large Step Settling time delay (where n=Num of NOP instructions)
+			int	PioSmallSettleCount; 		//Defines Small Step Settling time delay (ns; NOP counts in DataStructRev 1.00 & 2.00)
+			int	PioLargeSettleCount; 		//Defines Large Step Settling time delay (ns; NOP counts in DataStructRev 1.00 & 2.00)
 			int PioBreakpointCount;			//Defines Small-to-Large Step Breakpoint value (where n is in DAC counts, range: 0-4095)
-			int	PioUnblankCount;			//Defines UNBLANK Pulse Width (where n=Num of NOP instructions)
+			int	PioUnblankCount;			//Defines UNBLANK Pulse Width (ns; NOP counts in DataStructRev 1.00 & 2.00)
 		};
 				//	Define structure for timing-setup data that is held in EEPROM; If we're on the DUE platform, skip it!
 		struct EEpromData_2 {
 			float DataStructRev;			//Data structure revision designation
-			int	PioSmallSettleCount; 		//Defines Small Step Settling time delay (where n=Num of NOP instructions)
-			int	PioLargeSettleCount; 		//Defines Large Step Settling time delay (where n=Num of NOP instructions)
+			int	PioSmallSettleCount; 		//Defines Small Step Settling time delay (ns; NOP counts in DataStructRev 1.00 & 2.00)
+			int	PioLargeSettleCount; 		//Defines Large Step Settling time delay (ns; NOP counts in DataStructRev 1.00 & 2.00)
 			int PioBreakpointCount;			//Defines Small-to-Large Step Breakpoint value (where n is in DAC counts, range: 0-4095)
-			int	PioUnblankCount;			//Defines UNBLANK Pulse Width (where n=Num of NOP instructions)
+			int	PioUnblankCount;			//Defines UNBLANK Pulse Width (ns; NOP counts in DataStructRev 1.00 & 2.00)
 			bool Show_Digital_Time;			//Set to false to suppress digital display of time (ie: "11:27") on clock face 
 			bool Show_DayOfWeek;			//Set to false to suppress day of week (ie: "Wednesday") on clock face
 			bool Show_Date;					//Set to false to suppress date (ie: "November 6,2018") on clock face
@@ -788,11 +788,11 @@ void loop() {
 						}
 						//OPTION 10 - Save (Write) current Timing Dataset to EEprom
 						if (InputInteger[0]==10 ){	//Oper wants to UPDATE (write) EEPROM with current data-set
-								GBL_EE_SetupData.DataStructRev = 2.0;
-								GBL_EE_SetupData.PioSmallSettleCount = XYscope.PioSmallSettleCount;
-								GBL_EE_SetupData.PioLargeSettleCount= XYscope.PioLargeSettleCount;
+								GBL_EE_SetupData.DataStructRev = 3.0;
+								GBL_EE_SetupData.PioSmallSettleCount = XYscope.PioSmallSettleNs;
+								GBL_EE_SetupData.PioLargeSettleCount= XYscope.PioLargeSettleNs;
 								GBL_EE_SetupData.PioBreakpointCount = XYscope.NoSettlingTimeReqd;
-								GBL_EE_SetupData.PioUnblankCount=XYscope.PioUnblankCount;
+								GBL_EE_SetupData.PioUnblankCount=XYscope.PioUnblankNs;
 								GBL_EE_SetupData.Show_Digital_Time=Gbl_Show_Digital_Time;
 								GBL_EE_SetupData.Show_DayOfWeek=Gbl_Show_DayOfWeek;
 								GBL_EE_SetupData.Show_Date=Gbl_Show_Date;
@@ -1112,14 +1112,14 @@ void loop() {
 			case 'S':	//Change LARGE STEP PIO SETTLING TIME count.
 						//Only used for TEENSY & DUE_PIO modes.  Value is not used in DUE_DMA mode.
 				//Increase settling time Count
-				if (InputInteger[0]>-1 && InputInteger[0]<200){	//If number is in-range, set new value
-					XYscope.PioLargeSettleCount=InputInteger[0];
-					Serial.print(" <-LARGE DAC SETTLING count changed to: ");
-					Serial.println(XYscope.PioLargeSettleCount);
+				if (InputInteger[0]>-1 && InputInteger[0]<2000){	//If number is in-range, set new value
+					XYscope.PioLargeSettleNs=InputInteger[0];
+					Serial.print(" <-LARGE DAC SETTLING time (ns) changed to: ");
+					Serial.println(XYscope.PioLargeSettleNs);
 				}
 				else {
-					Serial.print(" <-Current LARGE DAC SETTLING count is: ");
-					Serial.print(XYscope.PioLargeSettleCount);
+					Serial.print(" <-Current LARGE DAC SETTLING time (ns) is: ");
+					Serial.print(XYscope.PioLargeSettleNs);
 					Serial.println (" (Not changed)");
 				}
 				delay(100);	//wait until changes ripple through before printing 'stats'
@@ -1129,14 +1129,14 @@ void loop() {
 			case 's':	//Change SMALL STEP PIO SETTLING TIME count
 						//Only used for TEENSY & DUE_PIO modes.  Value is not used in DUE_DMA mode.
 				//Increase settling time Count
-				if (InputInteger[0]>-1 && InputInteger[0]<150){	//If number is in-range, set new value
-					XYscope.PioSmallSettleCount=InputInteger[0];
-					Serial.print(" <-SMALL DAC SETTLING count changed to: ");
-					Serial.println(XYscope.PioSmallSettleCount);
+				if (InputInteger[0]>-1 && InputInteger[0]<1500){	//If number is in-range, set new value
+					XYscope.PioSmallSettleNs=InputInteger[0];
+					Serial.print(" <-SMALL DAC SETTLING time (ns) changed to: ");
+					Serial.println(XYscope.PioSmallSettleNs);
 				}
 				else {
-					Serial.print(" <-Current SMALL DAC SETTLING count is: ");
-					Serial.print(XYscope.PioSmallSettleCount);
+					Serial.print(" <-Current SMALL DAC SETTLING time (ns) is: ");
+					Serial.print(XYscope.PioSmallSettleNs);
 					Serial.println (" (Not changed)");
 				}
 				delay(100);	//wait until changes ripple through a couple of refresh cycles before printing 'stats'
@@ -1207,14 +1207,14 @@ void loop() {
 			case 'u':	//Change PIO UNBLANK count
 						//Only used for TEENSY & DUE_PIO modes.  Value is not used in DUE_DMA mode.
 				//Increase Unblank Count
-				if (InputInteger[0]>-1 && InputInteger[0]<200){	//If number is in-range, set new value
-					XYscope.PioUnblankCount=InputInteger[0];
-					Serial.print(" <-UNBLANK count changed to: ");
-					Serial.println(XYscope.PioUnblankCount);
+				if (InputInteger[0]>-1 && InputInteger[0]<2000){	//If number is in-range, set new value
+					XYscope.PioUnblankNs=InputInteger[0];
+					Serial.print(" <-UNBLANK time (ns) changed to: ");
+					Serial.println(XYscope.PioUnblankNs);
 				}
 				else {
-					Serial.print(" <-Current UNBLANK count is: ");
-					Serial.print(XYscope.PioUnblankCount);
+					Serial.print(" <-Current UNBLANK time (ns) is: ");
+					Serial.print(XYscope.PioUnblankNs);
 					Serial.println (" (Not changed)");
 				}
 				delay(100);	//wait until changes ripple through before printing 'stats'
@@ -1289,27 +1289,27 @@ void loop() {
 				if (PB_EndOfListPtr==0) PB_EndOfListPtr=XYscope.XYlistEnd;
 				if (PB_IncrBtn_DownEdge==HIGH){  //Increase settling time Count
 					PB_IncrBtn_DownEdge=LOW;	//Reset the edge detector...Only 
-					if (XYscope.PioSmallSettleCount<150){	//If number is still in-range, Increment it!
-						XYscope.PioSmallSettleCount++;
+					if (XYscope.PioSmallSettleNs<1500){	//If number is still in-range, Increment it!
+						XYscope.PioSmallSettleNs += 10;
 						
 						PB_EndOfListPtr=XYscope.XYlistEnd=PB_EndOfListPtr; 
 						PlotToCRT_HwSettings();
 						
-						Serial.print(" <-SMALL DAC SETTLING count changed to: ");
-						Serial.println(XYscope.PioSmallSettleCount);
+						Serial.print(" <-SMALL DAC SETTLING time (ns) changed to: ");
+						Serial.println(XYscope.PioSmallSettleNs);
 						
 					}
 				}
 				if (PB_DecrBtn_DownEdge==HIGH){  //Decrement settling time Count
 					PB_DecrBtn_DownEdge=LOW;	//Reset the edge detector...Only 
-					if (XYscope.PioSmallSettleCount>0){	//If number is still in-range, Decrement it!
-						XYscope.PioSmallSettleCount--;
+					if (XYscope.PioSmallSettleNs>=10){	//If number is still in-range, Decrement it!
+						XYscope.PioSmallSettleNs -= 10;
 						
 						PB_EndOfListPtr=XYscope.XYlistEnd=PB_EndOfListPtr; 
 						PlotToCRT_HwSettings();
 						
-						Serial.print(" <-SMALL DAC SETTLING count changed to: ");
-						Serial.println(XYscope.PioSmallSettleCount);
+						Serial.print(" <-SMALL DAC SETTLING time (ns) changed to: ");
+						Serial.println(XYscope.PioSmallSettleNs);
 					}
 				}
 
@@ -1319,26 +1319,26 @@ void loop() {
 				if (PB_EndOfListPtr==0) PB_EndOfListPtr=XYscope.XYlistEnd;
 				if (PB_IncrBtn_DownEdge==HIGH){  //Increase settling time Count
 					PB_IncrBtn_DownEdge=LOW;	//Reset the edge detector...Only 
-					if (XYscope.PioLargeSettleCount<200){	//If number is still in-range, Increment it!
-						XYscope.PioLargeSettleCount++;
+					if (XYscope.PioLargeSettleNs<2000){	//If number is still in-range, Increment it!
+						XYscope.PioLargeSettleNs += 10;
 						
 						PB_EndOfListPtr=XYscope.XYlistEnd=PB_EndOfListPtr; 
 						PlotToCRT_HwSettings();
 												
-						Serial.print(" <-LARGE DAC SETTLING count changed to: ");
-						Serial.println(XYscope.PioLargeSettleCount);
+						Serial.print(" <-LARGE DAC SETTLING time (ns) changed to: ");
+						Serial.println(XYscope.PioLargeSettleNs);
 					}
 				}
 				if (PB_DecrBtn_DownEdge==HIGH){  //Decrease settling time Count
 					PB_DecrBtn_DownEdge=LOW;	//Reset the edge detector...Only 
-					if (XYscope.PioLargeSettleCount>0){	//If number is still in-range, Decrement it!
-						XYscope.PioLargeSettleCount--;
+					if (XYscope.PioLargeSettleNs>=10){	//If number is still in-range, Decrement it!
+						XYscope.PioLargeSettleNs -= 10;
 						
 						PB_EndOfListPtr=XYscope.XYlistEnd=PB_EndOfListPtr; 
 						PlotToCRT_HwSettings();
 						
-						Serial.print(" <-Large DAC SETTLING count changed to: ");
-						Serial.println(XYscope.PioLargeSettleCount);
+						Serial.print(" <-Large DAC SETTLING time (ns) changed to: ");
+						Serial.println(XYscope.PioLargeSettleNs);
 					}
 				}
 			break;
@@ -1389,26 +1389,26 @@ void loop() {
 				if (PB_EndOfListPtr==0) PB_EndOfListPtr=XYscope.XYlistEnd;
 				if (PB_IncrBtn_DownEdge==HIGH){  //Increase Unblank time Count
 					PB_IncrBtn_DownEdge=LOW;	//Reset the edge detector...Only 
-					if (XYscope.PioUnblankCount<(200)){	//If number is still in-range, Increment it!
-						XYscope.PioUnblankCount++;
+					if (XYscope.PioUnblankNs<(2000)){	//If number is still in-range, Increment it!
+						XYscope.PioUnblankNs += 10;
 						
 						PB_EndOfListPtr=XYscope.XYlistEnd=PB_EndOfListPtr; 
 						PlotToCRT_HwSettings();
 						
-						Serial.print(" <-UNBLANK count changed to: ");
-						Serial.println(XYscope.PioUnblankCount);
+						Serial.print(" <-UNBLANK time (ns) changed to: ");
+						Serial.println(XYscope.PioUnblankNs);
 					}
 				}
 				if (PB_DecrBtn_DownEdge==HIGH){  //Decrement Unblank time Count
 					PB_DecrBtn_DownEdge=LOW;	//Reset the edge detector...Only 
-					if (XYscope.PioUnblankCount>0){	//If number is still in-range, Decrement it!
-						XYscope.PioUnblankCount--;
+					if (XYscope.PioUnblankNs>=10){	//If number is still in-range, Decrement it!
+						XYscope.PioUnblankNs -= 10;
 						
 						PB_EndOfListPtr=XYscope.XYlistEnd=PB_EndOfListPtr; 
 						PlotToCRT_HwSettings();
 						
-						Serial.print(" <-UNBLANK count changed to: ");
-						Serial.println(XYscope.PioUnblankCount);
+						Serial.print(" <-UNBLANK time (ns) changed to: ");
+						Serial.println(XYscope.PioUnblankNs);
 					}
 				}
 			break;
@@ -1498,6 +1498,8 @@ void P17_PlotRandomRectangles(int NumOfPoints,int NumOfLoops) {
 	//	Returns: NOTHING
 	//
 	//	20180701 Ver 0.0	E.Andrews	First cut
+	//	20261017 Ver 0.1	Points are added as one block with plotReserve()/setPoint()/plotAppend()
+	//	20261017 Ver 0.2	plotEnd() each loop; report beam path optimizer savings
 	//
 	if(NumOfPoints<1 || NumOfPoints>XYscope.MaxBuffSize) NumOfPoints=10000;	//Default to 10K Points
 	Serial.print (" <- Plotting Rectangles, ");Serial.print (NumOfPoints);Serial.print(" points...");
@@ -1508,6 +1510,7 @@ void P17_PlotRandomRectangles(int NumOfPoints,int NumOfLoops) {
 			XYscope.plotRectangle(random(4096),random(4096),random(4096),random(4096));
 			if (XYscope.XYlistEnd>NumOfPoints) break;
 		}
+		XYscope.plotEnd();	//Runs the beam path optimizer (CFG_BeamPathOptimizer) on the finished list
 		delay(100);
 		if (Serial.available())break; //ESCAPE if oper pushes any key
 	}	
@@ -1517,6 +1520,7 @@ void P17_PlotRandomRectangles(int NumOfPoints,int NumOfLoops) {
 	}
 	
 	Serial.print("DONE, Points Actually Plotted: ");Serial.println(XYscope.XYlistEnd);
+	if (CFG_BeamPathOptimizer) {Serial.print("Beam path: Large Steps saved ");Serial.print(XYscope.getBeamPathJumpsSaved());Serial.print(", settle ns saved per refresh ");Serial.println(XYscope.getBeamPathSettleSaved());}
 	//PrintStatsToConsole();
 }
 void P16_PlotRandomVectors(int NumOfPoints,int NumOfLoops) {
@@ -1556,6 +1560,7 @@ void P18_PlotRandomCircles(int NumOfPoints,int NumOfLoops) {
 	//	Returns: NOTHING
 	//
 	//	20180701 Ver 0.0	E.Andrews	First cut
+	//	20261017 Ver 0.1	plotEnd() each loop; report beam path optimizer savings
 	//
 	if(NumOfPoints<1 || NumOfPoints>XYscope.MaxBuffSize) NumOfPoints=10000;	//Default to 10K Points
 	Serial.print (" <- Plotting Circles, ");Serial.print (NumOfPoints);Serial.print(" points...");
@@ -1566,6 +1571,7 @@ void P18_PlotRandomCircles(int NumOfPoints,int NumOfLoops) {
 			XYscope.plotCircle(random(4096),random(4096),random(2048));
 			if (XYscope.XYlistEnd>NumOfPoints) break;
 		}
+		XYscope.plotEnd();	//Runs the beam path optimizer (CFG_BeamPathOptimizer) on the finished list
 		delay(100);
 		if (Serial.available())break; //ESCAPE if oper pushes any key	
 	}
@@ -1574,6 +1580,7 @@ void P18_PlotRandomCircles(int NumOfPoints,int NumOfLoops) {
 		d=d;	//Add this just to kill off a unused variable compiler warning
 	}
 	Serial.print("DONE, Points Actually Plotted: ");Serial.println(XYscope.XYlistEnd);
+	if (CFG_BeamPathOptimizer) {Serial.print("Beam path: Large Steps saved ");Serial.print(XYscope.getBeamPathJumpsSaved());Serial.print(", settle ns saved per refresh ");Serial.println(XYscope.getBeamPathSettleSaved());}
 	//PrintStatsToConsole();
 }
 void P19_PlotRandomEllipes(int NumOfPoints,int NumOfLoops) {
@@ -1584,6 +1591,7 @@ void P19_PlotRandomEllipes(int NumOfPoints,int NumOfLoops) {
 	//	Returns: NOTHING
 	//
 	//	20180701 Ver 0.0	E.Andrews	First cut
+	//	20261017 Ver 0.1	plotEnd() each loop; report beam path optimizer savings
 	//
 	if(NumOfPoints<1 || NumOfPoints>XYscope.MaxBuffSize) NumOfPoints=10000;	//Default to 10K Points
 	Serial.print (" <- Plotting Ellipses, ");Serial.print (NumOfPoints);Serial.print(" points...");
@@ -1594,6 +1602,7 @@ void P19_PlotRandomEllipes(int NumOfPoints,int NumOfLoops) {
 			XYscope.plotEllipse(random(4096),random(4096),random(2048),random(2048));
 			if (XYscope.XYlistEnd>NumOfPoints) break;
 		}
+		XYscope.plotEnd();	//Runs the beam path optimizer (CFG_BeamPathOptimizer) on the finished list
 		delay(100);
 		if (Serial.available())break; //ESCAPE if oper pushes any key	
 	}
@@ -1602,6 +1611,7 @@ void P19_PlotRandomEllipes(int NumOfPoints,int NumOfLoops) {
 		d=d;	//Add this just to kill off a unused variable compiler warning
 	}
 	Serial.print("DONE, Points Actually Plotted: ");Serial.println(XYscope.XYlistEnd);
+	if (CFG_BeamPathOptimizer) {Serial.print("Beam path: Large Steps saved ");Serial.print(XYscope.getBeamPathJumpsSaved());Serial.print(", settle ns saved per refresh ");Serial.println(XYscope.getBeamPathSettleSaved());}
 	//PrintStatsToConsole();
 }
 void P14_ShowSingleChar(int ChCode, int ChHt){
@@ -1703,9 +1713,12 @@ void P15_PlotRandomPoints(int NumOfPoints,int NumOfLoops){
 	if (NumOfLoops<1)NumOfLoops=1;
 	for (int c=0;c<NumOfLoops;c++){	
 		XYscope.plotStart();
-		for (int i=1;i<NumOfPoints;i++){
-			XYscope.plotPoint(random(4096),random(4096));
+		int n = NumOfPoints - 1;
+		XYscope::pointList *pts = XYscope.plotReserve(n);	//n is trimmed if the list can't hold them all
+		for (int i=0;i<n;i++){
+			XYscope::setPoint(pts[i], random(4096), random(4096));
 		}
+		XYscope.plotAppend(n);
 		XYscope.plotEnd();
 		XYscope.autoSetRefreshTime();
 		delay(100);
@@ -1792,6 +1805,7 @@ void P0_PlotOpAmpAdjustPattern(){
 	//
 	//	20170725 Ver 0.0	E.Andrews	First cut
 	//	20180425 Ver 1.0	E.Andrews	Now handles DUE and TEENSY processors	
+	//	20261017 Ver 1.1	Also report the RAM held by the XYscope object (font ROMs now live in flash)
 	//
 
 	XYscope.plotClear();	//This is not really needed...plotStart() does a clear and start.
@@ -1985,6 +1999,34 @@ void P14_PlotCharSet_2(){
 //=======================================================
 //	PONG Demo
 //=======================================================
+void P24_DrawCourt(int Lwall, int Rwall, int Twall, int Bwall) {
+	//	Clears the screen and draws the PONG court: walls, net, scores & paddles
+	//
+	//	20261017 Ver 0.0				Split out of P24_PongDemo()
+	//
+	XYscope.plotStart();
+	XYscope.plotLine(Lwall, Twall, Rwall, Twall);	//Top line
+	XYscope.plotLine(Rwall, Twall, Rwall, Bwall);	//Right line
+	XYscope.plotLine(Rwall, Bwall, Lwall, Bwall);	//Bottom line
+	XYscope.plotLine(Lwall, Bwall, Lwall, Twall);	//Left line
+	//Draw "net" as a dashed line down the center of the screen
+	const int dashLength = 200;
+	for (int dash = dashLength / 2; dash < Twall - dashLength / 2;
+			dash = dash + dashLength) {
+		XYscope.plotLine(Rwall / 2, dash, Rwall / 2, dash + dashLength / 2);//Center line
+	}
+
+	//Draw a simulated score...Note, scores do not change in DEMO code!
+	XYscope.printSetup(700, 3000, 800);
+	XYscope.print((char *)"18");
+	XYscope.printSetup(2700, 3000, 800);
+	XYscope.print((char *)"09");
+
+	//Draw simulated paddles...Paddles remain stationary in DEMO code!
+	XYscope.plotRectangle(200, 1200, 300, 1700);	//Left Paddle
+	XYscope.plotRectangle(3800, 1600, 3900, 2100);	//Right Paddle
+}
+
 void P24_PongDemo() {
 	// PONG style game display to demo how to do animation.
 	// This demo just moves a 'ball' around the screen bouncing off of walls.
@@ -2000,6 +2042,9 @@ void P24_PongDemo() {
 	//	20170708 Ver 0.0	E.Andrews	First cut
 	//						(Updated slightly throughout development cycle without version change)
 	//	20181521			E. Andrews  Checked/Updated slightly for use with TEENSY release
+	//	20261017 Ver 1.0				Ball now lives in its own display-list segment
+	//	20261017 Ver 1.1				Ball is drawn once as a sprite and stamped at each new position
+	//	20261017 Ver 1.2				Without segments (CFG_SegmentPoolSize = 0) the court & ball are redrawn each move
 	//
 	float ballX = 2048, ballY = 2048;//define and initialize ball at center of screenBall Center Point
 	int ballR = 75;					//Define Ball Radius
@@ -2009,38 +2054,20 @@ void P24_PongDemo() {
 
 	int Twall = 4095, Bwall = 0;		//Top & Bottom wall Y-Coord
 
-	int ballCount = 5, ballMax = 1;	//Define number of times to draw ball
-
 	// Clear screen and draw court
-	XYscope.plotStart();
-	XYscope.plotLine(Lwall, Twall, Rwall, Twall);	//Top line
-	XYscope.plotLine(Rwall, Twall, Rwall, Bwall);	//Right line
-	XYscope.plotLine(Rwall, Bwall, Lwall, Bwall);	//Bottom line
-	XYscope.plotLine(Lwall, Bwall, Lwall, Twall);	//Left line
-	//Draw "net" as a dashed line down the center of the screen
-	const int dashLength = 200;
-	for (int dash = dashLength / 2; dash < Twall - dashLength / 2;
-			dash = dash + dashLength) {
-		XYscope.plotLine(Rwall / 2, dash, Rwall / 2, dash + dashLength / 2);//Center line
-	}
+	P24_DrawCourt(Lwall, Rwall, Twall, Bwall);
 
-	//Draw a simulated score...Note, scores do not change in DEMO code!
-	XYscope.printSetup(700, 3000, 800);
-	XYscope.print((char *)"18");
-	XYscope.printSetup(2700, 3000, 800);
-	XYscope.print((char *)"09");
-
-	//Draw simulated paddles...Paddles remain stationary in DEMO code!
-	XYscope.plotRectangle(200, 1200, 300, 1700);	//Left Paddle
-	XYscope.plotRectangle(3800, 1600, 3900, 2100);	//Right Paddle
+	//Put the ball into its own segment.  The court stays in XY_List and is never touched again;
+	//every time the ball moves, only the ball segment is rebuilt.
+	int ballSeg = XYscope.segmentCreate("PongBall", 300);
 
-	//Remember the current XYlistEnd value so we can return to it every time we
-	//want to move and rewrite the ball
-	int ixEmptyCourt = XYscope.XYlistEnd;
+	//Draw the ball just once, as a sprite; moving it is then only a copy of its points
+	XYscope.spriteBegin(2048, 2048);
+	XYscope.plotCircle(2048, 2048, ballR);
+	int ballSprite = XYscope.spriteEnd();
 
 	Serial.print(" <- Running PONG DEMO; Press a key to stop DEMO...");
 	int wait = true;
-	ballCount = 0;
 
 	while (wait)	//In this loop, we just move the ball around the court!
 	{
@@ -2054,15 +2081,13 @@ void P24_PongDemo() {
 			Serial.println(F("(Stopped by Key Press)"));
 			delay(100);
 		}
-		//Draw Ball
-		XYscope.plotCircle(ballX, ballY, ballR);
-		ballCount = ballCount + 1;
-
-		//Plot the ball multiple times before moving it to make it brighter
-		if (ballCount > ballMax) {
-			XYscope.XYlistEnd = ixEmptyCourt;
-			ballCount = 0;
-		}
+		//Draw Ball (rebuilds just the ball segment)
+		if (ballSeg >= 0) XYscope.segmentBegin(ballSeg);
+		else P24_DrawCourt(Lwall, Rwall, Twall, Bwall);	//No segments (CFG_SegmentPoolSize = 0): redraw the whole screen
+		if (ballSprite >= 0) XYscope.spriteStamp(ballSprite, ballX, ballY);
+		else XYscope.plotCircle(ballX, ballY, ballR);	//Sprites off (CFG_MaxSprites) or no room for one
+		if (ballSeg >= 0) XYscope.segmentEnd();
+		else XYscope.plotCommit();
 
 		//Move Ball...
 		ballX = ballX + ballDX;
@@ -2096,6 +2121,8 @@ void P24_PongDemo() {
 		//  You Add this Part!!!
 
 	}
+	XYscope.segmentDeleteAll();	//Done with the ball...Give the segment pool back
+	XYscope.spriteDeleteAll();	//...and the sprite pool
 
 }
 //=========== END PONG DEMO =============================
@@ -2916,39 +2943,19 @@ void DrawClockMinHand(float CurrentMinutes){
 	//	Returns: NOTHING
 	//
 	//	20171106 Ver 0.0	E.Andrews	First cut
+	//	20261017 Ver 0.1				Hand is drawn pointing at 12 and turned by the 2D transform (no sin/cos per line)
 	//
-	int X0, Y0, X1, Y1;
 	float mins;
-	double TwoPi=atan(1)*8;
 
-	//Figure out the Theta, the ANGLE (in radians) of the hand based on the passed parameter.FYI: 0=12 o'clock, Pi=6 o'clock, etc...
 	mins=CurrentMinutes;
 	if (mins<0 or mins>59) mins=0;			//Bound the incoming value
-	double theta = TwoPi * mins/60.;		//This is the angle of the Minute hand
-	//theta = const_2pi / 60. * seconds;	//This is the angle of the Second Hand
-	//theta = const_2pi / 12. * hours;		//This is the angle of the Hour Hand
-
-	//Calculate the Coordinates for the center point of the END of the hand
-	//Gbl_Hour_End_X_Center = Gbl_X_Center + Gbl_Hour_HandLength * sin(theta);	//=+(Xc0)+Hand_Len*SIN(Theta)
-	//Gbl_Hour_End_Y_Center = Gbl_Y_Center + Gbl_Hour_HandLength * cos(theta);	//=+(Yc0)+Hand_Len*COS(Theta)
-	Gbl_Min_End_X_Center = Gbl_X_Center + Gbl_Min_HandLength * sin(theta);	//=+(Xc0)+Hand_Len*SIN(Theta)
-	Gbl_Min_End_Y_Center = Gbl_Y_Center + Gbl_Min_HandLength * cos(theta);	//=+(Yc0)+Hand_Len*COS(Theta)
-
-
-
-	//Calculate the Coordinates for LINE#1 of arm and draw this line	(min and hour hand only)
-	X0= int(Gbl_X_Center - Gbl_MinHubCenterRadius*cos(theta));					//+=Xc0-Radius_1*COS(Theta)
-	Y0= int(Gbl_Y_Center + Gbl_MinHubCenterRadius*sin(theta));					//=+Yc0-Radius_1*SIN(Theta)
-	X1=	int(Gbl_Min_End_X_Center);			//=+(Xc1_)-Radius_2*COS(Theta)
-	Y1=	int(Gbl_Min_End_Y_Center);			//=Yc1_+Radius_2*SIN(Theta)
-	XYscope.plotLine(X0,Y0,X1,Y1);
-
-	//Calculate the Coordinates for LINE#2 of arm and draw this line	(min and hour hand only)
-	X0= int(Gbl_X_Center + Gbl_MinHubCenterRadius*cos(theta));					//=+Xc0+Radius_1*COS(Theta)
-	Y0= int(Gbl_Y_Center - Gbl_MinHubCenterRadius*sin(theta));					//=+Yc0-Radius_1*SIN(Theta)
-	X1=	int(Gbl_Min_End_X_Center);			//=+Xc1_+Radius_2*COS(Theta)
-	Y1=	int(Gbl_Min_End_Y_Center);			//=+Yc1_-Radius_2*SIN(Theta)
-	XYscope.plotLine(X1,Y1,X0,Y0);	//Reverse order of vector for best plot quality
+
+	XYscope.pushTransform();
+	XYscope.translate(Gbl_X_Center, Gbl_Y_Center);	//The hand turns about the center of the clock face...
+	XYscope.rotate(-360. * mins / 60.);				//...clockwise from 12 o'clock
+	XYscope.plotLine(-Gbl_MinHubCenterRadius, 0, 0, Gbl_Min_HandLength);	//LINE#1 of arm
+	XYscope.plotLine(0, Gbl_Min_HandLength, Gbl_MinHubCenterRadius, 0);	//LINE#2 of arm (reverse order of vector for best plot quality)
+	XYscope.popTransform();
 }
 
 void DrawClockFace(){
@@ -3071,40 +3078,19 @@ void DrawClockHourHand(float CurrentHour){
 	//
 	//	20171106 Ver 0.0	E.Andrews	First cut
 	//	20180710 Ver 0.1	E.Andrews	Accepts Hours in 24 hour format(displays onto 12-hour face)
+	//	20261017 Ver 0.2				Hand is drawn pointing at 12 and turned by the 2D transform (no sin/cos per line)
 	//
-	int X0, Y0, X1, Y1;
 	float Hours;
-	double TwoPi=atan(1)*8;
 
-	//Figure out the Theta, the ANGLE (in radians) of the hand based on the passed parameter.FYI: 0=12 o'clock, Pi=6 o'clock, etc...
 	Hours=CurrentHour;
 	if (Hours<0 or Hours>12) Hours=Hours-12;	//Bound the incoming value
-	//double theta = TwoPi * mins/60.;			//This is the angle of the Minute hand
-	//double theta = TwoPi * seconds / 60.;		//This is the angle of the Second Hand
-	double theta = TwoPi * Hours/ 12.;			//This is the angle of the Hour Hand
-
-	//Calculate the Coordinates for the center point of the END of the hand
-	Gbl_Hour_End_X_Center = Gbl_X_Center + Gbl_Hour_HandLength * sin(theta);	//=+(Xc0)+Hand_Len*SIN(Theta)
-	Gbl_Hour_End_Y_Center = Gbl_Y_Center + Gbl_Hour_HandLength * cos(theta);	//=+(Yc0)+Hand_Len*COS(Theta)
-	//Gbl_Min_End_X_Center = Gbl_X_Center + Gbl_Min_HandLength * sin(theta);	//=+(Xc0)+Hand_Len*SIN(Theta)
-	//Gbl_Min_End_Y_Center = Gbl_Y_Center + Gbl_Min_HandLength * cos(theta);	//=+(Yc0)+Hand_Len*COS(Theta)
-
 
-
-	//Calculate the Coordinates for LINE#1 of arm and draw this line	(min and hour hand only)
-	X0= int(Gbl_X_Center - Gbl_Center_Radius*cos(theta));					//+=Xc0-Radius_1*COS(Theta)
-	Y0= int(Gbl_Y_Center + Gbl_Center_Radius*sin(theta));					//=+Yc0-Radius_1*SIN(Theta)
-	X1=	int(Gbl_Hour_End_X_Center);			//=+(Xc1_)-Radius_2*COS(Theta)
-	Y1=	int(Gbl_Hour_End_Y_Center);			//=Yc1_+Radius_2*SIN(Theta)
-	XYscope.plotLine(X0,Y0,X1,Y1);
-
-
-	//Calculate the Coordinates for LINE#2 of arm and draw this line	(min and hour hand only)
-	X0= int(Gbl_X_Center + Gbl_Center_Radius*cos(theta));					//=+Xc0+Radius_1*COS(Theta)
-	Y0= int(Gbl_Y_Center - Gbl_Center_Radius*sin(theta));					//=+Yc0-Radius_1*SIN(Theta)
-	X1=	int(Gbl_Hour_End_X_Center);			//=+Xc1_+Radius_2*COS(Theta)
-	Y1=	int(Gbl_Hour_End_Y_Center);			//=+Yc1_-Radius_2*SIN(Theta)
-	XYscope.plotLine(X1,Y1,X0,Y0);	//Reverse order of vector for best plot quality
+	XYscope.pushTransform();
+	XYscope.translate(Gbl_X_Center, Gbl_Y_Center);	//The hand turns about the center of the clock face...
+	XYscope.rotate(-360. * Hours / 12.);			//...clockwise from 12 o'clock
+	XYscope.plotLine(-Gbl_Center_Radius, 0, 0, Gbl_Hour_HandLength);	//LINE#1 of arm
+	XYscope.plotLine(0, Gbl_Hour_HandLength, Gbl_Center_Radius, 0);	//LINE#2 of arm (reverse order of vector for best plot quality)
+	XYscope.popTransform();
 }
 void DrawClockSecHand (int Secs){
 	//	Clock Routine that plots the SECONDS-hand
@@ -3481,23 +3467,24 @@ void P2_PeakToPeak_Dots() {
 		//
 		//	20180731 Ver 0.0 		 	E.Andrews	Checked for use with TEENSY release (DataStructRev=1.00).
 		//	20180731 Ver 0.1 		 	E.Andrews	Updated to used DataStructRev=2.00 (expanded to include clock display parameters)		
+		//	20261017 Ver 0.2	DataStructRev=3.00: settle & unblank times in ns (older revs hold NOP counts, not loaded)
 		//	
 		if(showDueOptions!=true){ //Don't try to read EEprom if we're running on an Arduino DUE!
 			GBL_EE_SetupData.DataStructRev = 0.0;		//Init in case we can't actually read EEPROM
 			EEPROM.get(eeStartAdr,GBL_EE_SetupData);	//Read data structure from EEpromData
 			Serial.print (" InitializeTiming_To_EEpromDataSet -- DataStructRev = ");Serial.println(GBL_EE_SetupData.DataStructRev);
 			if (GBL_EE_SetupData.DataStructRev == 1.00){  //Make sure data set rev is valid - If yes, init all timing values
-				XYscope.PioSmallSettleCount = GBL_EE_SetupData.PioSmallSettleCount;
-				XYscope.PioLargeSettleCount = GBL_EE_SetupData.PioLargeSettleCount;
+				//Settle & unblank values are NOP counts; keep the XYscopeConfig.h times (ns)
 				XYscope.NoSettlingTimeReqd = GBL_EE_SetupData.PioBreakpointCount;
-				XYscope.PioUnblankCount = GBL_EE_SetupData.PioUnblankCount;
 				Serial.print ("Initialized from EEPROM Ver: ");Serial.println(GBL_EE_SetupData.DataStructRev);
 			}
-			if (GBL_EE_SetupData.DataStructRev == 2.00){  //Make sure data set rev is valid - If yes, init all timing values
-				XYscope.PioSmallSettleCount = GBL_EE_SetupData.PioSmallSettleCount;
-				XYscope.PioLargeSettleCount = GBL_EE_SetupData.PioLargeSettleCount;
+			if (GBL_EE_SetupData.DataStructRev == 2.00 || GBL_EE_SetupData.DataStructRev == 3.00){  //Make sure data set rev is valid - If yes, init all timing values
+				if (GBL_EE_SetupData.DataStructRev == 3.00){	//Rev 2.00 settle & unblank values are NOP counts; keep the XYscopeConfig.h times (ns)
+					XYscope.PioSmallSettleNs = GBL_EE_SetupData.PioSmallSettleCount;
+					XYscope.PioLargeSettleNs = GBL_EE_SetupData.PioLargeSettleCount;
+					XYscope.PioUnblankNs = GBL_EE_SetupData.PioUnblankCount;
+				}
 				XYscope.NoSettlingTimeReqd = GBL_EE_SetupData.PioBreakpointCount;
-				XYscope.PioUnblankCount = GBL_EE_SetupData.PioUnblankCount;
 				Gbl_Show_Digital_Time=GBL_EE_SetupData.Show_Digital_Time;
 				Gbl_Show_DayOfWeek=GBL_EE_SetupData.Show_DayOfWeek;
 				Gbl_Show_Date=GBL_EE_SetupData.Show_Date;
@@ -3523,10 +3510,10 @@ void P2_PeakToPeak_Dots() {
 		//	Now, compare ACTIVE to EEPROM variable by variable
 		//
 		//	do NOT check GBL_EE_SetupData.DataStructRev
-		if(GBL_EE_SetupData.PioSmallSettleCount != XYscope.PioSmallSettleCount) ReturnValue=false;
-		if(GBL_EE_SetupData.PioLargeSettleCount != XYscope.PioLargeSettleCount) ReturnValue=false;
+		if(GBL_EE_SetupData.PioSmallSettleCount != XYscope.PioSmallSettleNs) ReturnValue=false;
+		if(GBL_EE_SetupData.PioLargeSettleCount != XYscope.PioLargeSettleNs) ReturnValue=false;
 		if(GBL_EE_SetupData.PioBreakpointCount != XYscope.NoSettlingTimeReqd) ReturnValue=false;
-		if(GBL_EE_SetupData.PioUnblankCount != XYscope.PioUnblankCount) ReturnValue=false;
+		if(GBL_EE_SetupData.PioUnblankCount != XYscope.PioUnblankNs) ReturnValue=false;
 		
 		if(GBL_EE_SetupData.Show_Digital_Time != Gbl_Show_Digital_Time) ReturnValue=false;
 		if(GBL_EE_SetupData.Show_DayOfWeek != Gbl_Show_DayOfWeek) ReturnValue=false;
@@ -3552,13 +3539,13 @@ void P2_PeakToPeak_Dots() {
 		Serial.print("     |         Data Structure Rev: ");Serial.println(GBL_EE_SetupData.DataStructRev);
 		Serial.println("     |                         EEPROM / ACTIVE_VALUE");
 		Serial.print("     |       PIO_Small_Settle_Cnt: ");Serial.print(GBL_EE_SetupData.PioSmallSettleCount);
-			Serial.print(" / ");Serial.print(XYscope.PioSmallSettleCount);Serial.println("");
+			Serial.print(" / ");Serial.print(XYscope.PioSmallSettleNs);Serial.println("");
 		Serial.print("     |       PIO_Large_Settle_Cnt: ");Serial.print(GBL_EE_SetupData.PioLargeSettleCount);
-			Serial.print(" / ");Serial.print(XYscope.PioLargeSettleCount);Serial.println("");			
+			Serial.print(" / ");Serial.print(XYscope.PioLargeSettleNs);Serial.println("");			
 		Serial.print("     |        PIO_Break_Point_Cnt: ");Serial.print(GBL_EE_SetupData.PioBreakpointCount);
 			Serial.print(" / ");Serial.print(XYscope.NoSettlingTimeReqd);Serial.println("");			
 		Serial.print("     |PIO_Unblank_Pulse_Width_Cnt: ");Serial.print(GBL_EE_SetupData.PioUnblankCount);
-			Serial.print(" / ");Serial.print(XYscope.PioUnblankCount);Serial.println("");
+			Serial.print(" / ");Serial.print(XYscope.PioUnblankNs);Serial.println("");
 		Serial.print("     |    Show_Digital_Time(0=NO): ");Serial.print(GBL_EE_SetupData.Show_Digital_Time);
 			Serial.print(" / ");Serial.print(Gbl_Show_Digital_Time);Serial.println("");									
 		Serial.print("     |       Show_DayOfWeek(0=NO): ");Serial.print(GBL_EE_SetupData.Show_DayOfWeek);
@@ -3579,11 +3566,11 @@ void P2_PeakToPeak_Dots() {
 void PlotToCRT_HwSettings(){
 	//	Routine to display Timing Settings to CRT Screen
 	//	Prints:	
-	//		XYscope.PioSmallSettleCount		Small Step Settling Count Value
-	//		XYscope.PioLargeSettleCount		Large Step Settling Count Value
+	//		XYscope.PioSmallSettleNs		Small Step Settling Count Value
+	//		XYscope.PioLargeSettleNs		Large Step Settling Count Value
 
 	//		XYscope.NoSettlingTimeReqd		Large Step Threshold Count Value(0-4095)
-	//		XYscope.PioUnblankCount			UNBLANK Pulse Width Count Value
+	//		XYscope.PioUnblankNs			UNBLANK Pulse Width Count Value
 	//
 	//	Passed Parameters	NONE
 	//
@@ -3592,9 +3579,9 @@ void PlotToCRT_HwSettings(){
 	//	20180719 Ver 0.0 		 	E.Andrews	1st pass effort
 	//
 	XYscope.printSetup(20,4095-170,150);	//void printSetup(short textX, short textY, short textSize)
-	XYscope.print("Small-Step_Settle:");XYscope.print(XYscope.PioSmallSettleCount); XYscope.print(" Large-Step_Settle:");XYscope.print(XYscope.PioLargeSettleCount);
+	XYscope.print("Small-Step_Settle:");XYscope.print(XYscope.PioSmallSettleNs); XYscope.print(" Large-Step_Settle:");XYscope.print(XYscope.PioLargeSettleNs);
 	XYscope.printSetup(20,4095-2*170,150);	//void printSetup(short textX, short textY, short textSize)
-	XYscope.print("Large-Step-Threshold:");XYscope.print(XYscope.NoSettlingTimeReqd); XYscope.print(" UNBLANK:");XYscope.print(XYscope.PioUnblankCount);
+	XYscope.print("Large-Step-Threshold:");XYscope.print(XYscope.NoSettlingTimeReqd); XYscope.print(" UNBLANK:");XYscope.print(XYscope.PioUnblankNs);
 }
 
 void PlotToCRT_SetTimeDateScreen(int ST_hour, int ST_minute, int ST_second, int ST_month, int ST_day,int ST_year, int ST_State){
@@ -3844,6 +3831,7 @@ void PrintStatsToConsole(void) {
 	//
 	//	20170811 Ver 0.0	E.Andrews	First cut
 	//	20180510 Ver 1.0	E.Andrews	Added PIO stats (TEENSY) and also inserted 50ms delay before printing
+	//	20261017 Ver 1.1	Paint time & refresh jitter percentiles over the last frames (telemetry ring)
 	//
 	delay(100);	//Insert delay so stats are valid after last change...
 	Serial.print(F("\n STATS..............\n  MaxBuffSize: "));
@@ -3885,11 +3873,11 @@ void PrintStatsToConsole(void) {
 		Serial.print(F(", Refresh Rate: ")); Serial.print(float(1000000) / float(XYscope.ActiveRefreshPeriod_us),1); Serial.print(F(" Hz"));
 		Serial.println();
 		Serial.print(F("  Small-Step Settling: "));
-		Serial.print(XYscope.PioSmallSettleCount);
+		Serial.print(XYscope.PioSmallSettleNs);
 		Serial.print(F("  Large-Step Settling: "));
-		Serial.print(XYscope.PioLargeSettleCount);
+		Serial.print(XYscope.PioLargeSettleNs);
 		Serial.print(F("  Pio Unblank:"));
-		Serial.print(XYscope.PioUnblankCount);
+		Serial.print(XYscope.PioUnblankNs);
 		Serial.print(F("  Big-Step Threshold:"));
 		Serial.print(XYscope.NoSettlingTimeReqd);
 		Serial.println();
@@ -3899,8 +3887,21 @@ void PrintStatsToConsole(void) {
 		float Avg_Point_PeriodUs=float(XYscope.act_PaintTimeDurationUs)/float(XYscope.XYlistEnd);
 		Serial.print(F(", Avg Point Period: "));Serial.print (Avg_Point_PeriodUs);Serial.print(F(" us"));
 		Serial.println();
+		XYscope::frameStats Stats;
+		XYscope.getFrameStats(Stats);
+		Serial.print(F("  Last "));Serial.print(Stats.frames);Serial.print(F(" frames: Paint p50/p95/p99/max "));
+		Serial.print(Stats.paintP50Us);Serial.print(F("/"));Serial.print(Stats.paintP95Us);Serial.print(F("/"));
+		Serial.print(Stats.paintP99Us);Serial.print(F("/"));Serial.print(Stats.paintMaxUs);Serial.print(F(" us, Jitter p95/max "));
+		Serial.print(Stats.jitterP95Us);Serial.print(F("/"));Serial.print(Stats.jitterMaxUs);Serial.print(F(" us, Overruns "));
+		Serial.print(Stats.overruns);
+		Serial.println();
 		
 	}
+	if (CFG_GlyphCacheBytes > 0) {
+		Serial.print(F("  Glyph cache hits/misses: "));Serial.print(XYscope.getGlyphCacheHits());
+		Serial.print(F("/"));Serial.print(XYscope.getGlyphCacheMisses());
+		Serial.println();
+	}
 
 
 	Serial.print(F("  Graphics Int: "));
@@ -4618,4 +4619,7 @@ void ShowMemory() {
 	
 		//Serial.println("\n No memory usage report available for TEENSY 3.6.");	
 	#endif
+	Serial.print(F("  XYscope object RAM: "));
+	Serial.print(sizeof(XYscope));
+	Serial.println(F(" bytes"));
 }
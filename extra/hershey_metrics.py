@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+# hershey_metrics.py
+#
+# Rebuilds the HersheyGlyphIndex[] table in src/HersheyFontROM.h from the HersheyVertexStream[] data.
+# Run this after editing any glyph in HersheyVertexStream[]:
+#
+#	python3 extra/hershey_metrics.py [path/to/HersheyFontROM.h]
+#
+# For each character (one '// <name>   ASCII nn' comment line per character in the stream) it works out:
+#	Offset, Length			position & size of the character in HersheyVertexStream[]
+#	CellLeft, CellRight		smallest & largest X coordinate (the cell always includes X=0)
+#	Advance					proportional spacing cell width = CellRight-CellLeft+4, never less than 8
+# Width is carried over from the existing table (it is the original Hershey character width).
+#
+#	20261017 Ver 0.0	First cut
+
+import re
+import sys
+
+PEN_UP = 'HersheyPenUp'
+
+def main():
+	path = sys.argv[1] if len(sys.argv) > 1 else 'src/HersheyFontROM.h'
+	src = open(path).read()
+
+	stream = re.search(r'HersheyVertexStream\[\d+\] PROGMEM = \{\n(.*?)\n\t\};', src, re.S)
+	index = re.search(r'(HersheyGlyphIndex\[95\] PROGMEM = \{\n)(.*?)(\n\t\};)', src, re.S)
+
+	glyphs = []		#[name, [stream tokens]]
+	for line in stream.group(1).split('\n'):
+		m = re.match(r'\s*//\s*(.*ASCII \d+)', line)
+		if m:
+			glyphs.append([m.group(1), []])
+			continue
+		glyphs[-1][1] += [t.strip() for t in line.split(',') if t.strip()]
+	if len(glyphs) != 95:
+		sys.exit('expected 95 characters in HersheyVertexStream[], found %d' % len(glyphs))
+
+	widths = [int(re.findall(r'-?\d+', row)[2]) for row in index.group(2).split('\n')]
+
+	rows = []
+	offset = 0
+	for (name, toks), width in zip(glyphs, widths):
+		left = right = 0
+		i = 0
+		while i < len(toks):
+			if toks[i] == PEN_UP:
+				i += 1
+				continue
+			x = int(toks[i])
+			left = min(left, x)
+			right = max(right, x)
+			i += 2
+		advance = max(right - left + 4, 8)
+		rows.append('\t\t{%5d,%4d,%3d,%4d,%4d,%3d},\t// %s' % (offset, len(toks), width, left, right, advance, name))
+		offset += len(toks)
+
+	total = re.search(r'HersheyVertexStream\[(\d+)\]', src)
+	if int(total.group(1)) != offset:
+		sys.exit('HersheyVertexStream[] is declared with %s bytes but holds %d' % (total.group(1), offset))
+
+	src = src[:index.start(2)] + '\n'.join(rows) + src[index.end(2):]
+	open(path, 'w').write(src)
+	print('%s: %d characters, %d stream bytes' % (path, len(rows), offset))
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,122 @@
+//Arduino.h  (HOST build shim)
+
+
+/*
+
+Minimal stand-in for the Arduino core so the XYscope library can be compiled and run on a Linux
+(or other desktop) computer.  Only what XYscope.cpp and the host tools use is provided:
+
+	millis(), micros()					Real (wall clock) time since the program started
+	delay(), delayMicroseconds()		Sleep
+	pinMode(), digitalWrite(), digitalRead()	No hardware; digitalWrite() remembers the last value per pin
+	noInterrupts(), interrupts()		Do nothing (the host build is single threaded)
+	random(), randomSeed()				Arduino style random numbers
+	min(), max(), abs(), constrain()
+	Serial								print()/println() to stdout (DEC, HEX, OCT, BIN & float digits)
+
+Beam output (DAC writes & blanking) goes to the HostSimOutput backend in XYscopeBackend.h, not to
+digitalWrite().  Build with XYSCOPE_HOST defined and this folder ahead of src/ on the include path:
+
+	g++ -O2 -std=gnu++11 -DXYSCOPE_HOST -Iextra/host -Isrc yourProgram.cpp src/XYscope.cpp
+
+F_CPU defaults to 180 MHz so the TEENSY 3.6 settle & unblank counts in XYscopeConfig.h are used;
+define F_CPU on the command line to simulate a different clock.
+
+	20261017 Ver 0.0	First cut
+
+*/
+
+#ifndef XYSCOPE_HOST_ARDUINO_H_	//#include Guard
+	#define XYSCOPE_HOST_ARDUINO_H_
+
+	#include <stdint.h>
+	#include <stdlib.h>
+	#include <string.h>
+	#include <math.h>
+	#include <stdio.h>
+	#include <algorithm>
+	#include <chrono>
+	#include <thread>
+
+	#ifndef ARDUINO
+		#define ARDUINO 186
+	#endif
+	#ifndef F_CPU
+		#define F_CPU 180000000		//Simulate a TEENSY 3.6 at 180 MHz
+	#endif
+
+	typedef bool boolean;
+	typedef uint8_t byte;
+
+	#define PROGMEM
+	#define HIGH 1
+	#define LOW 0
+	#define INPUT 0
+	#define OUTPUT 1
+	#define DEC 10
+	#define HEX 16
+	#define OCT 8
+	#define BIN 2
+
+	using std::min;
+	using std::max;
+	#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+	//Time
+	inline uint64_t hostMicros64(void) {
+		static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	}
+	inline unsigned long micros(void) {return (unsigned long) hostMicros64();}
+	inline unsigned long millis(void) {return (unsigned long) (hostMicros64() / 1000);}
+	inline void delay(unsigned long ms) {std::this_thread::sleep_for(std::chrono::milliseconds(ms));}
+	inline void delayMicroseconds(unsigned int us) {std::this_thread::sleep_for(std::chrono::microseconds(us));}
+
+	//Pins & interrupts
+	inline int &hostPinState(uint8_t pin) {static int pins[256]; return pins[pin];}
+	inline void pinMode(uint8_t pin, uint8_t mode) {(void) pin; (void) mode;}
+	inline void digitalWrite(uint8_t pin, uint8_t value) {hostPinState(pin) = value;}
+	inline int digitalRead(uint8_t pin) {return hostPinState(pin);}
+	inline void noInterrupts(void) {}
+	inline void interrupts(void) {}
+
+	//Random numbers
+	inline void randomSeed(unsigned long seed) {srand(seed);}
+	inline long random(long howBig) {return howBig <= 0 ? 0 : rand() % howBig;}
+	inline long random(long howSmall, long howBig) {return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);}
+
+	//Serial (stdout)
+	class HostSerial {
+	  public:
+		void begin(unsigned long baud) {(void) baud;}
+		operator bool() {return true;}
+		void print(const char *s) {fputs(s, stdout);}
+		void print(char c) {putchar(c);}
+		void print(int n, int base = DEC) {print((long) n, base);}
+		void print(unsigned int n, int base = DEC) {print((unsigned long) n, base);}
+		void print(long n, int base = DEC) {
+			if (base == DEC || n >= 0) {
+				if (n < 0) {putchar('-'); print((unsigned long) -n, base);}
+				else print((unsigned long) n, base);
+			} else print((unsigned long) n, base);	//Arduino prints negative HEX/OCT/BIN as unsigned
+		}
+		void print(unsigned long n, int base = DEC) {
+			char buf[8 * sizeof(long) + 1];
+			char *p = &buf[sizeof(buf) - 1];
+			*p = 0;
+			if (base < 2) base = 10;
+			do {
+				int d = n % base;
+				*--p = d < 10 ? '0' + d : 'A' + d - 10;
+				n /= base;
+			} while (n);
+			fputs(p, stdout);
+		}
+		void print(double f, int digits = 2) {printf("%.*f", digits, f);}
+		void println(void) {putchar('\n');}
+		template <class T> void println(T v) {print(v); println();}
+		template <class T> void println(T v, int format) {print(v, format); println();}
+	};
+	static HostSerial Serial __attribute__((unused));
+
+#endif	//End XYSCOPE_HOST_ARDUINO_H_
@@ -0,0 +1,366 @@
+/*
+	xyscope_bench.cpp  (HOST build)
+
+	Measures how fast the XYscope rasterizers fill the XY_List (points per second for each kind of figure)
+	and what one refresh of the resulting list costs, both in host time and in simulated TEENSY time
+	(HostSimOutput, see src/XYscopeBackend.h).  Run it before & after a change to catch performance
+	regressions without flashing hardware.
+
+	Build & run from the library folder (or build the CMake target of the same name, see CMakeLists.txt):
+
+		g++ -O2 -std=gnu++11 -DXYSCOPE_HOST -DCFG_PrimitiveDisplayList=true -Iextra/host -Isrc extra/host/xyscope_bench.cpp src/XYscope.cpp -o xyscope_bench
+		./xyscope_bench [trials]
+
+	Each figure is timed 'trials' times (default 7) and the fastest run is reported, which filters out
+	most of the noise of a busy build machine.
+
+	The old/new cases time a rasterizer against the code it replaced (kept here, plotting through plotPoint),
+	on the figures used to measure the change.
+
+	The primitive display list case compares the RAM and refresh time of one scene kept as XY_List points
+	with the same scene kept as primitives (rasterized by the refresh loop); it needs CFG_PrimitiveDisplayList.
+
+	20261017 Ver 0.0	First cut
+	20261017 Ver 0.1	Primitive display list vs XY_List case
+	20261017 Ver 0.2	Arcs: old float plotEllipse vs the sine table rasterizer
+	20261017 Ver 0.3	Lines: old Bresenham plotLine vs the line stepper
+	20261017 Ver 0.4	Span append: plotPoint() per point vs plotReserve()/plotAppend() & the rasterizer fast paths
+	20261017 Ver 0.5	Prints sizeof(XYscope)
+*/
+#define private public		//The before/after cases set _graphDensity directly
+#include <Arduino.h>
+#include <XYscope.h>
+#undef private
+
+XYscope XYscope;
+
+static int trials = 7;
+static int fillPoints;		//Points each figure adds per timing run (kept well below the list size)
+
+typedef void (*figureFn)(int k);
+
+static void figPoint(int k)		{XYscope.plotPoint((k * 37) & 4095, (k * 91) & 4095);}
+static void figLineShort(int k)	{int x = (k * 97) & 3967, y = (k * 53) & 3967; XYscope.plotLine(x, y, x + 120, y + 70);}
+static void figLineLong(int k)	{XYscope.plotLine(k & 255, 0, 4095 - (k & 255), 4095);}
+static void figRectangle(int k)	{XYscope.plotRectangle(200 + (k & 63), 200, 3800, 3000 - (k & 63));}
+static void figCircle(int k)	{XYscope.plotCircle(2048, 2048, 300 + (k & 1023));}
+static void figArc(int k)		{XYscope.plotEllipse(2048, 2048, 1800, 600 + (k & 511), 0x0f);}
+static void figVectorText(int k)	{XYscope.setActiveFont(_VectorFont); XYscope.printSetup(100, 2000 + (k & 255), 200); XYscope.print((char *)"HELLO 12:34");}
+static void figHersheyText(int k)	{XYscope.setActiveFont(_HersheyFont); XYscope.printSetup(100, 2000 + (k & 255), 200); XYscope.print((char *)"Hello 12:34");}
+static void figSpan(int k) {
+	int n = 256;
+	XYscope::pointList *p = XYscope.plotReserve(n);
+	for (int i = 0; i < n; i++) XYscope::setPoint(p[i], (i * 16) & 4095, (k * 8 + i) & 4095);
+	XYscope.plotAppend(n);
+}
+
+static double nowSec(void) {return hostMicros64() * 1e-6;}
+
+static void benchFigure(const char *name, figureFn fig) {
+	double best = 1e30;
+	long points = 0;
+	for (int t = 0; t < trials; t++) {
+		XYscope.plotStart();
+		int start = XYscope.XYlistEnd;
+		int k = 0;
+		double t0 = nowSec();
+		while (XYscope.XYlistEnd - start < fillPoints) fig(k++);
+		double dt = nowSec() - t0;
+		points = XYscope.XYlistEnd - start;
+		if (dt < best) best = dt;
+	}
+	printf("  %-14s %10.2f Mpoints/s %9.1f ns/point\n", name, points / best * 1e-6, best * 1e9 / points);
+}
+
+static double bestPaintSec(void) {	//Fastest of 'trials' refreshes (host time); HostSimOutput keeps the last one's simulated time
+	double best = 1e30;
+	for (int t = 0; t < trials; t++) {
+		HostSimOutput::reset();
+		double t0 = nowSec();
+		XYscope.initiatePioScreenPaint();
+		double dt = nowSec() - t0;
+		if (dt < best) best = dt;
+	}
+	return best;
+}
+
+static void benchPaint(const char *name, figureFn fig) {
+	XYscope.plotStart();
+	int k = 0;
+	while (XYscope.XYlistEnd < fillPoints) fig(k++);
+	int points = XYscope.XYlistEnd;
+	double best = bestPaintSec();
+	printf("  %-14s %7d points %8.1f ns/point (host) %9.1f us/refresh (simulated, %.0f%% beam ON)\n", name, points,
+		best * 1e9 / points, HostSimOutput::now_ps * 1e-6, 100.0 * HostSimOutput::beamOn_ps / HostSimOutput::now_ps);
+}
+
+typedef void (*callFn)(void);
+
+static double timeCalls(callFn fn, long calls) {	//Host time of one fn() call, averaged over 'calls' calls
+	XYscope.plotStart();
+	double t0 = nowSec();
+	for (long c = 0; c < calls; c++) fn();
+	return (nowSec() - t0) / calls;
+}
+
+//	Arcs: plotEllipse before the sine table rasterizer (float cos/sin per point, every arc segment tested per point)
+static void oldPlotEllipse(int xc, int yc, int xr, int yr, uint8_t arcSegment) {
+	const float pi = atan(1) * 4;
+	const float arcAng1 = pi * .25, arcAng2 = pi * .5, arcAng3 = pi * .75, arcAng4 = pi;
+	const float arcAng5 = pi * 1.25, arcAng6 = pi * 1.50, arcAng7 = pi * 1.75, FullCircle = 2 * pi;
+	float circumf = FullCircle * sqrt((pow(xr, 2) + pow(yr, 2)) / 2.);
+	float numOfPoints = circumf / XYscope._graphDensity;
+	float deltaAng = FullCircle / (numOfPoints);
+	float angle;
+	short X, Y;
+	for (angle = 0; angle < FullCircle; angle = angle + deltaAng) {
+		X = int(xc - cos(angle) * xr);
+		Y = int(yc + sin(angle) * yr);
+		if (arcSegment & XYscope::arc0 && angle <= arcAng1) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc1 && angle > arcAng1 && angle <= arcAng2) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc2 && angle > arcAng2 && angle <= arcAng3) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc3 && angle > arcAng3 && angle <= arcAng4) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc4 && angle > arcAng4 && angle <= arcAng5) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc5 && angle > arcAng5 && angle <= arcAng6) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc6 && angle > arcAng6 && angle <= arcAng7) XYscope.plotPoint(X, Y);
+		if (arcSegment & XYscope::arc7 && angle > arcAng7) XYscope.plotPoint(X, Y);
+	}
+}
+static void arcGlyphOld(void)		{oldPlotEllipse(2048, 2048, 6, 6, 0x03);}
+static void arcGlyphNew(void)		{XYscope.plotCircle(2048, 2048, 6, 0x03);}
+static void ellGlyphOld(void)		{oldPlotEllipse(2048, 2048, 9, 14, 0xff);}
+static void ellGlyphNew(void)		{XYscope.plotEllipse(2048, 2048, 9, 14, 0xff);}
+static void circle200Old(void)		{oldPlotEllipse(2048, 2048, 200, 200, 0xff);}
+static void circle200New(void)		{XYscope.plotCircle(2048, 2048, 200);}
+static void circle2000Old(void)		{oldPlotEllipse(2048, 2048, 2000, 2000, 0xff);}
+static void circle2000New(void)		{XYscope.plotCircle(2048, 2048, 2000);}
+static void ellHalfOld(void)		{oldPlotEllipse(2048, 2048, 1800, 900, 0x0f);}
+static void ellHalfNew(void)		{XYscope.plotEllipse(2048, 2048, 1800, 900, 0x0f);}
+
+//	Lines: plotLine before the line stepper (Bresenham over every count, keeping every (density+1)th point)
+static void oldPlotLine(int x0, int y0, int x1, int y1) {
+	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+	int dy = abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+	int err = (dx > dy ? dx : -dy) / 2, e2;
+	int SkipCount = 0;
+	for (;;) {
+		if (SkipCount <= 0) {
+			XYscope.plotPoint(x0, y0);
+			SkipCount = XYscope._graphDensity;
+		} else {
+			SkipCount--;
+		}
+		if (x0 == x1 && y0 == y1) break;
+		e2 = err;
+		if (e2 > -dx) {err -= dy; x0 += sx;}
+		if (e2 < dy) {err += dx; y0 += sy;}
+	}
+}
+static void lineLongOld(void)		{oldPlotLine(48, 1000, 4048, 3000);}
+static void lineLongNew(void)		{XYscope.plotLine(48, 1000, 4048, 3000);}
+static void lineGlyphOld(void)		{oldPlotLine(2048, 2048, 2068, 2060);}
+static void lineGlyphNew(void)		{XYscope.plotLine(2048, 2048, 2068, 2060);}
+static void rectOld(void) {
+	oldPlotLine(500, 1000, 3500, 1000);
+	oldPlotLine(3500, 1000, 3500, 3000);
+	oldPlotLine(3500, 3000, 500, 3000);
+	oldPlotLine(500, 3000, 500, 1000);
+}
+static void rectNew(void)			{XYscope.plotRectangle(500, 1000, 3500, 3000);}
+
+//	Span append: lines & arcs before the span API plotted every point through plotPoint() (screen saver millis(),
+//	screen wrap & end-of-buffer checks per point); P15_PlotRandomPoints used plotPoint() before plotReserve()/plotAppend()
+static const int spanPoints = 10000, spanLines = 500, spanVectors = 200, spanCircles = 20;
+static short randX[spanPoints], randY[spanPoints];		//P15 points, then the line & vector end points
+
+static bool stepNext(XYscope::lineStepper &ls, int &X, int &Y) {	//XYscope::lineStepNext (inline in XYscope.cpp)
+	if (ls.count <= 0) return false;
+	X = ls.x;
+	Y = ls.y;
+	ls.count--;
+	int minorStep = ls.minorWhole;
+	ls.minorRem += ls.minorFrac;
+	if (ls.minorRem >= ls.minorDen) {
+		ls.minorRem -= ls.minorDen;
+		minorStep++;
+	}
+	if (ls.xMajor) {
+		ls.x += ls.majorStep;
+		ls.y += ls.minorSign * minorStep;
+	} else {
+		ls.y += ls.majorStep;
+		ls.x += ls.minorSign * minorStep;
+	}
+	return true;
+}
+static void pointPlotLine(int x0, int y0, int x1, int y1) {
+	XYscope::lineStepper ls;
+	int X, Y;
+	XYscope.lineStepStart(ls, x0, y0, x1, y1, XYscope._graphDensity);
+	while (stepNext(ls, X, Y)) XYscope.plotPoint(X, Y);
+}
+static void pointPlotCircle(int xc, int yc, int r) {
+	uint32_t step = XYscope.arcPhaseStep(r, r);
+	for (uint64_t phase = 0; phase < 0x100000000ULL; phase += step) {	//All 8 arc segments
+		uint32_t angle = uint32_t(phase);
+		XYscope.plotPoint(xc - ((r * XYscope.sinQ15(angle + 0x40000000UL) + 16384) >> 15), yc + ((r * XYscope.sinQ15(angle) + 16384) >> 15));
+	}
+}
+static void p15Old(void) {
+	for (int i = 0; i < spanPoints; i++) XYscope.plotPoint(randX[i], randY[i]);
+}
+static void p15New(void) {
+	int n = spanPoints;
+	XYscope::pointList *p = XYscope.plotReserve(n);
+	for (int i = 0; i < n; i++) XYscope::setPoint(p[i], randX[i], randY[i]);
+	XYscope.plotAppend(n);
+}
+//	P16 lines are shortened to 512 counts or less so 500 of them fit in the list (full-screen ones would overflow it)
+static void linesOld(void) {
+	for (int i = 0; i < spanLines * 2; i += 2) {
+		int x = randX[i] & 3583, y = randY[i] & 3583;
+		pointPlotLine(x, y, x + (randX[i + 1] & 511), y + (randY[i + 1] & 511));
+	}
+}
+static void linesNew(void) {
+	for (int i = 0; i < spanLines * 2; i += 2) {
+		int x = randX[i] & 3583, y = randY[i] & 3583;
+		XYscope.plotLine(x, y, x + (randX[i + 1] & 511), y + (randY[i + 1] & 511));
+	}
+}
+static void vectorsOld(void) {
+	for (int i = 0; i < spanVectors; i++) pointPlotLine(randX[i], randY[i], randX[i] + (i % 21), randY[i] + 20 - (i % 21));
+}
+static void vectorsNew(void) {
+	for (int i = 0; i < spanVectors; i++) XYscope.plotLine(randX[i], randY[i], randX[i] + (i % 21), randY[i] + 20 - (i % 21));
+}
+static void circlesOld(void)	{for (int i = 1; i <= spanCircles; i++) pointPlotCircle(2048, 2048, i * 100);}
+static void circlesNew(void)	{for (int i = 1; i <= spanCircles; i++) XYscope.plotCircle(2048, 2048, i * 100);}
+
+static void benchOldNew(const char *name, callFn oldFn, callFn newFn, bool nsPerCall) {
+	//Old & new are timed in turn in every trial so both see the same machine load; the fastest of each is reported
+	XYscope.plotStart();
+	oldFn();
+	long oldPoints = XYscope.XYlistEnd;
+	XYscope.plotStart();
+	newFn();
+	long newPoints = XYscope.XYlistEnd;
+	long calls = max(fillPoints / max(max(oldPoints, newPoints), 1L), 1L);
+	double oldSec = 1e30, newSec = 1e30;
+	for (int t = 0; t < trials; t++) {
+		oldSec = min(oldSec, timeCalls(oldFn, calls));
+		newSec = min(newSec, timeCalls(newFn, calls));
+	}
+	if (nsPerCall) printf("  %-30s %6ld %9.0f %9.0f ns\n", name, newPoints, oldSec * 1e9, newSec * 1e9);
+	else printf("  %-30s %6ld %9.1f %9.1f Mpoints/s\n", name, newPoints, oldPoints / oldSec * 1e-6, newPoints / newSec * 1e-6);
+	if (oldPoints != newPoints) printf("  %-30s (old code plots %ld points)\n", "", oldPoints);
+}
+
+static void primScene(bool prim) {	//10 lines, a circle, a half ellipse & a line of text, as points or as primitives
+	XYscope.plotStart();
+	XYscope.primClear();
+	for (int i = 0; i < 10; i++) {
+		int x = 200 + i * 400;
+		if (prim) XYscope.primLine(x, 200, 4095 - x, 3300);
+		else XYscope.plotLine(x, 200, 4095 - x, 3300);
+	}
+	if (prim) XYscope.primCircle(2048, 1750, 1400);
+	else XYscope.plotCircle(2048, 1750, 1400);
+	if (prim) XYscope.primEllipse(2048, 1750, 1900, 900, 0x0f);
+	else XYscope.plotEllipse(2048, 1750, 1900, 900, 0x0f);
+	XYscope.printSetup(300, 3500, 300);
+	if (prim) XYscope.primPrint("XYscope 12:34");
+	else XYscope.print((char *) "XYscope 12:34");
+	XYscope.plotEnd();
+}
+
+static void benchPrimitives(void) {
+	if (!CFG_PrimitiveDisplayList) {
+		printf("Primitive display list: skipped (build with CFG_PrimitiveDisplayList true)\n");
+		return;
+	}
+	XYscope.setActiveFont(_HersheyFont);	//Glyph primitives are Hershey characters
+	primScene(false);
+	long points = XYscope.XYlistEnd;
+	double listSec = bestPaintSec();
+	double listSimUs = HostSimOutput::now_ps * 1e-6;
+	primScene(true);
+	double primSec = bestPaintSec();
+	printf("Primitive display list vs XY_List (10 lines, circle, half ellipse, 13 characters):\n");
+	printf("  %-10s %5ld points %7ld bytes %8.1f us/refresh (host) %9.1f us/refresh (simulated)\n", "XY_List",
+		points, points * (long) sizeof(XYscope::pointList), listSec * 1e6, listSimUs);
+	printf("  %-10s %5d prims  %7lu bytes %8.1f us/refresh (host) %9.1f us/refresh (simulated, %lu points)\n", "primitives",
+		XYscope.getPrimCount(), (unsigned long) XYscope.getPrimBytesUsed(), primSec * 1e6, HostSimOutput::now_ps * 1e-6,
+		(unsigned long) XYscope.getPrimPointsPainted());
+	XYscope.primClear();
+	XYscope.setActiveFont(_VectorFont);
+}
+
+int main(int argc, char **argv) {
+	if (argc > 1) trials = max(1, atoi(argv[1]));
+	XYscope.begin();
+	XYscope.setScreenSaveSecs(0);	//Screen saver would stop the paint benchmark
+	XYscope.setGraphicsIntensity(50);
+	XYscope.setTextIntensity(50);
+	fillPoints = (XYscope.MaxBuffSize * 3) / 4;
+
+	printf("XYscope host benchmark: F_CPU=%ld, list size %ld points, %d trials (best reported)\n",
+		(long) F_CPU, (long) XYscope.MaxBuffSize, trials);
+	long poolBytes = sizeof(XYscope.XY_ListPool) + sizeof(XYscope.XY_SegmentPool) + sizeof(XYscope.XY_SpritePool) +
+		sizeof(XYscope.XY_PrimList) + sizeof(XYscope._glyphPool);
+	printf("RAM: sizeof(XYscope) %ld bytes = %ld in the point lists & pools + %ld other (the font tables are const, not members)\n",
+		(long) sizeof(XYscope), poolBytes, (long) sizeof(XYscope) - poolBytes);
+	printf("Plot (XY_List fill rate):\n");
+	benchFigure("plotPoint", figPoint);
+	benchFigure("plotLine short", figLineShort);
+	benchFigure("plotLine long", figLineLong);
+	benchFigure("plotRectangle", figRectangle);
+	benchFigure("plotCircle", figCircle);
+	benchFigure("plotEllipse arc", figArc);
+	benchFigure("print Vector", figVectorText);
+	benchFigure("print Hershey", figHersheyText);
+	benchFigure("plotAppend", figSpan);
+
+	printf("Paint (initiatePioScreenPaint, PIO settle %d/%d ns, unblank %d ns):\n",
+		XYscope.PioLargeSettleNs, XYscope.PioSmallSettleNs, XYscope.PioUnblankNs);
+	benchPaint("lines", figLineLong);
+	benchPaint("circles", figCircle);
+	benchPaint("scattered", figPoint);
+
+	printf("Arcs, old float cos/sin plotEllipse vs sine table (density 10):\n");
+	printf("  %-30s %6s %9s %9s\n", "case", "points", "old", "new");
+	XYscope._graphDensity = 10;
+	benchOldNew("glyph arc r=6 (2 segments)", arcGlyphOld, arcGlyphNew, false);
+	benchOldNew("glyph ellipse 9x14", ellGlyphOld, ellGlyphNew, false);
+	benchOldNew("circle r=200", circle200Old, circle200New, false);
+	benchOldNew("full-screen circle r=2000", circle2000Old, circle2000New, false);
+	benchOldNew("ellipse 1800x900 (4 segments)", ellHalfOld, ellHalfNew, false);
+
+	printf("Lines, old Bresenham over every count vs line stepper:\n");
+	printf("  %-30s %6s %9s %9s\n", "case", "points", "old", "new");
+	XYscope._graphDensity = 9;
+	benchOldNew("4000-count line, density 9", lineLongOld, lineLongNew, true);
+	XYscope._graphDensity = 0;
+	benchOldNew("4000-count line, density 0", lineLongOld, lineLongNew, true);
+	XYscope._graphDensity = 9;
+	benchOldNew("20-count glyph vector, density 9", lineGlyphOld, lineGlyphNew, true);
+	benchOldNew("rectangle 3000x2000, density 9", rectOld, rectNew, true);
+	XYscope.setGraphicsIntensity(50);
+
+	printf("Span append, every point through plotPoint() vs plotReserve()/plotAppend() & rasterizer fast paths (density 9):\n");
+	printf("  %-30s %6s %9s %9s\n", "case", "points", "old", "new");
+	srand(1);
+	for (int i = 0; i < spanPoints; i++) {
+		randX[i] = rand() & 4095;
+		randY[i] = rand() & 4095;
+	}
+	XYscope._graphDensity = 9;
+	benchOldNew("P15 10000 random points", p15Old, p15New, true);
+	benchOldNew("500 random lines <= 512 counts", linesOld, linesNew, true);
+	benchOldNew("200 glyph-size vectors", vectorsOld, vectorsNew, true);
+	benchOldNew("20 concentric circles", circlesOld, circlesNew, true);
+	XYscope.setGraphicsIntensity(50);
+
+	benchPrimitives();
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*
+	xyscope_dma.cpp  (HOST build)
+
+	Checks the TEENSY eDMA + PDB paint (CFG_TnsyDmaPaint) without hardware.  The frame is painted by the real
+	initiatePioScreenPaint(), which builds the DMA sample ring (DmaSchedule, src/XYscopeBackend.h); the
+	HostDmaOutput model sends it half by half into HostSimOutput, one sample every CFG_TnsyDmaSampleNs, and
+	calls the refill interrupt in between as the eDMA does.  The beam events are then checked:
+
+		The DACs never move while the beam is ON (no streaks)
+		Every unblank pulse is as long as PioUnblankNs, rounded up to whole samples
+		Every point settles at least PioSmallSettleNs (PioLargeSettleNs for a Large Step), rounded up
+		The beam is OFF at the end of the frame
+
+	and the paint time is compared with the predicted one (paintCostUs).
+
+	Needs CFG_TnsyDmaPaint; the xyscope_dma CMake target (CMakeLists.txt) turns it on.  By hand, from the library
+	folder:
+
+		g++ -O2 -std=gnu++11 -DXYSCOPE_HOST -DCFG_TnsyDmaPaint=true -Iextra/host -Isrc extra/host/xyscope_dma.cpp src/XYscope.cpp -o xyscope_dma
+		./xyscope_dma [-i frame.txt] [-v]
+
+	-i file reads a frame as for xyscope_phosphor ("X Y" per line); -v lists every failed check.
+	Exit code is 1 when a check fails.
+
+	20261017 Ver 0.0	First cut
+	20261017 Ver 0.1	Settle & unblank times in ns
+	20261017 Ver 0.2	CFG_TnsyDmaPaint set on the command line (CMake target)
+*/
+#include <Arduino.h>
+#include <XYscope.h>
+#include <string>
+
+#if !CFG_TnsyDmaPaint
+	#error Set CFG_TnsyDmaPaint to true in src/XYscopeConfig.h to build xyscope_dma
+#endif
+
+XYscope XYscope;
+
+static bool verbose = false;
+static bool beamOn = false;
+static int priorX = -1, priorY = -1;			//Last lit point
+static uint64_t movedAt_ps, unblankAt_ps;
+static uint32_t points, largeSteps, streaks, shortSettles, badPulses;
+static uint64_t settle_ps, largeSettle_ps, pulse_ps;	//Required times
+
+static uint64_t sampled_ps(uint16_t ns) {	//Delay as the DMA paint sends it: CPU cycles, rounded up to samples
+	return uint64_t(DmaSchedule::ticks((ns * (F_CPU / 1000000) + 999) / 1000)) * DmaSchedule::sample_ps;
+}
+
+static void fail(const char *what, const XYscopeSimEvent &e) {
+	if (verbose) printf("  %-14s at %9.3f us  X=%4d Y=%4d\n", what, e.t_ps * 1e-6, e.x, e.y);
+}
+
+static void onBeamEvent(const XYscopeSimEvent &e) {
+	if (e.type == HostSimOutput::SimDac) {
+		if (beamOn) {streaks++; fail("streak", e);}
+		movedAt_ps = e.t_ps;
+	} else if (e.type == HostSimOutput::SimUnblank) {
+		bool large = priorX < 0 || max(abs(e.x - priorX), abs(e.y - priorY)) > XYscope.NoSettlingTimeReqd;
+		if (e.t_ps - movedAt_ps < (large ? largeSettle_ps : settle_ps) && (e.x != priorX || e.y != priorY)) {
+			shortSettles++;
+			fail("short settle", e);
+		}
+		largeSteps += large;
+		points++;
+		priorX = e.x;
+		priorY = e.y;
+		beamOn = true;
+		unblankAt_ps = e.t_ps;
+	} else if (beamOn) {
+		if (e.t_ps - unblankAt_ps != pulse_ps) {badPulses++; fail("pulse width", e);}
+		beamOn = false;
+	}
+}
+
+static void demoFrame(void) {
+	XYscope.plotRectangle(100, 100, 3995, 3995);
+	XYscope.plotCircle(2048, 2048, 1500);
+	XYscope.plotLine(2048, 2048, 2048, 3200);
+	XYscope.plotLine(2048, 2048, 2900, 1700);
+	XYscope.setActiveFont(_HersheyFont);
+	XYscope.printSetup(1400, 2600, 180);
+	XYscope.print((char *)"12:34");
+	for (int i = 0; i < 3; i++) XYscope.plotPoint(3600, 600);	//Repeated point: no DAC move
+}
+
+static bool loadFrame(const char *fileName) {
+	FILE *f = fopen(fileName, "r");
+	if (!f) return false;
+	char line[128];
+	while (fgets(line, sizeof(line), f)) {
+		int x, y;
+		if (line[0] == '#') continue;
+		if (sscanf(line, "%d %d", &x, &y) == 2) XYscope.plotPoint(x, y);
+	}
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char **argv) {
+	const char *inFile = NULL;
+	for (int a = 1; a < argc; a++) {
+		std::string opt = argv[a];
+		if (opt == "-v") verbose = true;
+		else if (opt == "-i" && a + 1 < argc) inFile = argv[++a];
+		else {fprintf(stderr, "usage: %s [-i frame.txt] [-v]\n", argv[0]); return 1;}
+	}
+
+	XYscope.begin();
+	XYscope.setScreenSaveSecs(0);
+	XYscope.plotStart();
+	if (inFile) {
+		if (!loadFrame(inFile)) {fprintf(stderr, "can't read %s\n", inFile); return 1;}
+	} else demoFrame();
+	XYscope.plotEnd();
+
+	settle_ps = sampled_ps(XYscope.PioSmallSettleNs);
+	largeSettle_ps = sampled_ps(XYscope.PioLargeSettleNs);
+	pulse_ps = sampled_ps(XYscope.PioUnblankNs);
+	uint32_t predictedUs = XYscope.predicted_PaintTimeUs;
+
+	HostSimOutput::reset();
+	HostDmaOutput::halvesSent = 0;
+	HostSimOutput::trace = onBeamEvent;
+	XYscope.initiatePioScreenPaint();
+	HostSimOutput::trace = NULL;
+
+	double paint_us = HostSimOutput::now_ps * 1e-6;
+	printf("XYscope eDMA + PDB model: %u ns samples, ring 2 x %u samples\n", (unsigned) CFG_TnsyDmaSampleNs, (unsigned) DmaSchedule::HalfSamples);
+	printf("  Settle %.0f ns (Large Step %.0f ns), unblank pulse %.0f ns\n", settle_ps * 1e-3, largeSettle_ps * 1e-3, pulse_ps * 1e-3);
+	printf("  %u points (%u Large Steps) in %u half rings: %.1f us, predicted %u us, beam ON %.1f%%\n", points, largeSteps,
+		HostDmaOutput::halvesSent, paint_us, predictedUs, 100.0 * HostSimOutput::beamOn_ps / max(HostSimOutput::now_ps, (uint64_t) 1));
+	printf("  Streaks %u, short settles %u, wrong pulse widths %u, beam %s at the end\n", streaks, shortSettles, badPulses, beamOn ? "ON" : "OFF");
+	bool ok = streaks == 0 && shortSettles == 0 && badPulses == 0 && !beamOn && points > 0;
+	printf("%s\n", ok ? "PASS" : "FAIL");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+/*
+	xyscope_phosphor.cpp  (HOST build)
+
+	Virtual phosphor: renders what one XYscope frame looks like on a CRT, so beam order and density changes
+	can be judged without a scope on the bench.
+
+	The frame is painted by the real refresh loop (initiatePioScreenPaint) into the HostSimOutput backend
+	(src/XYscopeBackend.h), so the settle & unblank times (ns) from XYscopeConfig.h set the timing.  Each
+	unblank pulse deposits energy = beam ON (dwell) time into a gaussian spot.  Phosphor light decays
+	exponentially between refreshes; the image is the steady state (after many refreshes) seen either at
+	the END of a refresh (shows early points of a long frame fading = flicker) or AVERAGED over a refresh.
+
+	Cells of the screen that collect far more energy per frame than the typical lit cell (points stacked
+	on top of one another: line ends, rectangle corners, dense text) are reported as burn-in hot spots.
+
+	Build & run from the library folder (or build the CMake target of the same name, see CMakeLists.txt):
+
+		g++ -O2 -std=gnu++11 -DXYSCOPE_HOST -Iextra/host -Isrc extra/host/xyscope_phosphor.cpp src/XYscope.cpp -o xyscope_phosphor
+		./xyscope_phosphor [options]
+
+	Options:
+		-i file		Frame to render: one "X Y" point per line (# starts a comment).  Default: built in demo frame
+		-o file		Output image (binary PPM).  Default: phosphor.ppm
+		-d file		Also write the painted frame as "X Y" lines (a recorded frame for -i)
+		-s pixels	Image width & height.  Default: 512
+		-spot n		Spot size: gaussian sigma in DAC counts.  Default: 6
+		-tau us		Phosphor decay time constant in microseconds.  Default: 20000 (medium persistence P31)
+		-avg		Average over the refresh period instead of showing the end of the refresh
+		-hot n		Hot spot threshold: times the median energy of lit cells.  Default: 8
+
+	20261017 Ver 0.0	First cut
+*/
+#include <Arduino.h>
+#include <XYscope.h>
+#include <vector>
+#include <string>
+
+XYscope XYscope;
+
+struct beamSample {
+	uint16_t x, y;			//DAC position while the beam was ON
+	double t_us;			//Start of the unblank pulse (from the start of the paint)
+	double dwell_us;		//Beam ON time
+};
+static std::vector<beamSample> samples;
+static double unblankStart_us;
+static bool beamWasOn;
+
+static void onBeamEvent(const XYscopeSimEvent &e) {
+	double t_us = e.t_ps * 1e-6;
+	if (e.type == HostSimOutput::SimUnblank) {
+		unblankStart_us = t_us;
+		beamWasOn = true;
+	} else if (e.type == HostSimOutput::SimBlank && beamWasOn) {
+		beamSample s = {e.x, e.y, unblankStart_us, t_us - unblankStart_us};
+		samples.push_back(s);
+		beamWasOn = false;
+	}
+}
+
+static void demoFrame(void) {
+	XYscope.plotRectangle(100, 100, 3995, 3995);
+	XYscope.plotCircle(2048, 2048, 1500);
+	for (int a = 0; a < 12; a++) {	//Clock face ticks
+		float r = a * 3.14159265f / 6;
+		XYscope.plotLine(2048 + 1350 * cos(r), 2048 + 1350 * sin(r), 2048 + 1480 * cos(r), 2048 + 1480 * sin(r));
+	}
+	XYscope.plotLine(2048, 2048, 2048, 3200);	//Hands
+	XYscope.plotLine(2048, 2048, 2900, 1700);
+	XYscope.setActiveFont(_HersheyFont);
+	XYscope.printSetup(1400, 2600, 180);
+	XYscope.print((char *)"12:34");
+	XYscope.setActiveFont(_VectorFont);
+	XYscope.printSetup(1500, 1200, 120);
+	XYscope.print((char *)"XYSCOPE");
+	for (int i = 0; i < 40; i++) XYscope.plotPoint(3600, 600);	//A parked spot: burn-in hazard
+}
+
+static bool loadFrame(const char *fileName) {
+	FILE *f = fopen(fileName, "r");
+	if (!f) return false;
+	char line[128];
+	while (fgets(line, sizeof(line), f)) {
+		int x, y;
+		if (line[0] == '#') continue;
+		if (sscanf(line, "%d %d", &x, &y) == 2) XYscope.plotPoint(x, y);
+	}
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char **argv) {
+	const char *inFile = NULL, *outFile = "phosphor.ppm", *dumpFile = NULL;
+	int size = 512;
+	double spot = 6, tau_us = 20000, hotFactor = 8;
+	bool average = false;
+	for (int a = 1; a < argc; a++) {
+		std::string opt = argv[a];
+		const char *val = a + 1 < argc ? argv[a + 1] : NULL;
+		if (opt == "-avg") {average = true; continue;}
+		if (!val) {fprintf(stderr, "%s: missing value\n", argv[a]); return 1;}
+		if (opt == "-i") inFile = val;
+		else if (opt == "-o") outFile = val;
+		else if (opt == "-d") dumpFile = val;
+		else if (opt == "-s") size = max(16, atoi(val));
+		else if (opt == "-spot") spot = max(0.5, atof(val));
+		else if (opt == "-tau") tau_us = max(1.0, atof(val));
+		else if (opt == "-hot") hotFactor = atof(val);
+		else {fprintf(stderr, "unknown option %s\n", argv[a]); return 1;}
+		a++;
+	}
+
+	XYscope.begin();
+	XYscope.setScreenSaveSecs(0);
+	XYscope.plotStart();
+	if (inFile) {
+		if (!loadFrame(inFile)) {fprintf(stderr, "can't read %s\n", inFile); return 1;}
+	} else demoFrame();
+	XYscope.plotEnd();
+
+	//Paint one frame into the simulation backend and collect the unblank pulses
+	HostSimOutput::reset();
+	HostSimOutput::trace = onBeamEvent;
+	XYscope.initiatePioScreenPaint();
+	HostSimOutput::trace = NULL;
+	double paint_us = HostSimOutput::now_ps * 1e-6;
+	double refresh_us = max(double(CFG_CrtMinRefresh_us), paint_us + CFG_TNSY_3_6_MinimumComputeTimeUs);	//As autoSetRefreshTime() on TEENSY
+
+	if (dumpFile) {
+		FILE *f = fopen(dumpFile, "w");
+		if (f) {
+			fprintf(f, "# XYscope frame: %u points\n", (unsigned) samples.size());
+			for (size_t i = 0; i < samples.size(); i++) fprintf(f, "%d %d\n", samples[i].x, samples[i].y);
+			fclose(f);
+		}
+	}
+
+	//Phosphor model.  Energy E deposited at time t of a refresh of period T; in the steady state the light
+	//seen at the end of a refresh is E*exp(-(T-t)/tau) / (1-exp(-T/tau)); averaged over the refresh it is E*tau/T.
+	std::vector<float> image(size * size, 0.f);
+	double scale = size / 4096.0, sigma = spot * scale;
+	int radius = int(ceil(3 * sigma));
+	std::vector<float> kernel((2 * radius + 1) * (2 * radius + 1));
+	for (int dy = -radius; dy <= radius; dy++)
+		for (int dx = -radius; dx <= radius; dx++)
+			kernel[(dy + radius) * (2 * radius + 1) + dx + radius] = exp(-(dx * dx + dy * dy) / (2 * sigma * sigma));
+	double steady = 1 / (1 - exp(-refresh_us / tau_us));
+
+	const int cellShift = 4, cells = 4096 >> cellShift;	//16 x 16 DAC count hot spot cells
+	std::vector<double> cellEnergy(cells * cells, 0);
+	std::vector<int> cellPoints(cells * cells, 0);
+	for (size_t i = 0; i < samples.size(); i++) {
+		const beamSample &s = samples[i];
+		double light = average ? s.dwell_us * tau_us / refresh_us : s.dwell_us * exp(-(refresh_us - s.t_us) / tau_us) * steady;
+		int px = int(s.x * scale), py = size - 1 - int(s.y * scale);	//Y=0 is the bottom of the screen
+		for (int dy = -radius; dy <= radius; dy++) {
+			int y = py + dy;
+			if (y < 0 || y >= size) continue;
+			for (int dx = -radius; dx <= radius; dx++) {
+				int x = px + dx;
+				if (x < 0 || x >= size) continue;
+				image[y * size + x] += light * kernel[(dy + radius) * (2 * radius + 1) + dx + radius];
+			}
+		}
+		int c = (s.y >> cellShift) * cells + (s.x >> cellShift);
+		cellEnergy[c] += s.dwell_us;
+		cellPoints[c]++;
+	}
+
+	//Tone map: the 99th percentile of lit pixels is shown at ~86% brightness
+	std::vector<float> lit;
+	for (size_t i = 0; i < image.size(); i++) if (image[i] > 0) lit.push_back(image[i]);
+	float ref = 1;
+	if (!lit.empty()) {
+		size_t k = lit.size() * 99 / 100;
+		std::nth_element(lit.begin(), lit.begin() + k, lit.end());
+		ref = lit[k] > 0 ? lit[k] : 1;
+	}
+	FILE *f = fopen(outFile, "wb");
+	if (!f) {fprintf(stderr, "can't write %s\n", outFile); return 1;}
+	fprintf(f, "P6\n%d %d\n255\n", size, size);
+	for (size_t i = 0; i < image.size(); i++) {
+		double b = 1 - exp(-2 * image[i] / ref);
+		unsigned char rgb[3] = {(unsigned char) (255 * 0.35 * b), (unsigned char) (255 * b), (unsigned char) (255 * 0.45 * b)};	//P31 green
+		fwrite(rgb, 1, 3, f);
+	}
+	fclose(f);
+
+	printf("%u points painted in %.1f us (simulated), refresh period %.1f us, tau %.0f us, %s\n",
+		(unsigned) samples.size(), paint_us, refresh_us, tau_us, average ? "averaged" : "end of refresh");
+	printf("Beam ON %.1f%% of the paint, %u unblanks; image written to %s\n",
+		100.0 * HostSimOutput::beamOn_ps / HostSimOutput::now_ps, HostSimOutput::unblanks, outFile);
+
+	//Hot spots: cells holding more than hotFactor x the median energy of lit cells
+	std::vector<double> litCells;
+	for (size_t c = 0; c < cellEnergy.size(); c++) if (cellEnergy[c] > 0) litCells.push_back(cellEnergy[c]);
+	if (litCells.empty()) return 0;
+	std::nth_element(litCells.begin(), litCells.begin() + litCells.size() / 2, litCells.end());
+	double median = litCells[litCells.size() / 2];
+	std::vector<std::pair<double, int> > hot;
+	for (size_t c = 0; c < cellEnergy.size(); c++)
+		if (cellEnergy[c] > hotFactor * median) hot.push_back(std::make_pair(cellEnergy[c], int(c)));
+	std::sort(hot.rbegin(), hot.rend());
+	printf("Hot spots (> %.0fx the median lit %dx%d cell, %.3f us/frame): %u\n", hotFactor, 1 << cellShift, 1 << cellShift, median, (unsigned) hot.size());
+	for (size_t i = 0; i < hot.size() && i < 10; i++) {
+		int c = hot[i].second;
+		printf("  X=%4d..%4d Y=%4d..%4d  %4d points  %7.3f us/frame  %5.1fx\n",
+			(c % cells) << cellShift, ((c % cells + 1) << cellShift) - 1, (c / cells) << cellShift, ((c / cells + 1) << cellShift) - 1,
+			cellPoints[c], hot[i].first, hot[i].first / median);
+	}
+	return 0;
+}
@@ -0,0 +1,889 @@
+/*
+	xyscope_tests.cpp  (HOST build)
+
+	Unit tests for the XYscope display list code.  Each test checks that a faster way of building or painting
+	a frame gives exactly the points of the plain way it replaced:
+
+		doubleBuffer	Frames built with plotStart/plotCommit while the refresh routine paints in between (whole
+						paints and single slices of a sliced paint): every paint shows one whole committed frame,
+						also when the refresh stalls part way through a sliced frame
+		segments		Rebuilding, hiding & moving a middle segment vs the points of the XY_List & other segments
+		beamPath		Beam path optimizer: re-ordered list vs the list as plotted (same points, no more Large Steps)
+		lod				LOD level for a frame too big for the LOD period: steady, period held, down a level only with room to spare
+		costGain		Paint time cost model gain: near 1.0 & predicts the paint, follows slower/faster boards within 0.25..4
+		telemetry		Frame telemetry: nearest rank p50/p95/p99/max over a known frame sequence, overruns, ring wrap
+		primitives		Primitive display list rasterized in the paint loop vs the same figures in XY_List
+		hershey			Packed Hershey font & glyph metrics: print() output checksum; getTextWidth() = print() advance
+		lineStepper		plotLine vs Bresenham over every count (same points, minor axis within one count)
+		glyphCache		print() through the glyph cache vs the font rasterizers (plotChar_V / plotChar_H)
+		sprites			spriteStamp vs drawing the shape again at the new place
+		transform		A translation vs plotting at the translated place; rotated square extents
+		clipping		Lines & arcs running off screen vs stepping the whole figure and dropping off-screen points
+
+	Needs CFG_DoubleBufferXYlist, CFG_SlicedPaint, segments, CFG_BeamPathOptimizer, CFG_PrimitiveDisplayList, the glyph
+	cache and sprites; the xyscope_tests CMake target turns them on.  By hand, from the library folder:
+
+		g++ -O2 -std=gnu++11 -DXYSCOPE_HOST -DCFG_DoubleBufferXYlist=true -DCFG_SlicedPaint=true -DCFG_SegmentPoolSize=5000 \
+			-DCFG_BeamPathOptimizer=true -DCFG_PrimitiveDisplayList=true -DCFG_GlyphCacheBytes=8192 -DCFG_MaxSprites=8 -DCFG_SpritePoolSize=1000 \
+			-Iextra/host -Isrc extra/host/xyscope_tests.cpp src/XYscope.cpp -o xyscope_tests
+		./xyscope_tests [-v]
+
+	-v lists every failed check.  Exit code is 1 when a check fails.
+
+	20261017 Ver 0.0	First cut
+	20261017 Ver 0.1	Double buffered frames painted whole & in slices (doubleBuffer)
+	20261017 Ver 0.2	doubleBuffer: refresh stalled part way through a sliced frame
+	20261017 Ver 0.3	segments
+	20261017 Ver 0.4	beamPath
+	20261017 Ver 0.5	lod
+	20261017 Ver 0.6	costGain
+	20261017 Ver 0.7	telemetry
+*/
+#define private public		//The tests look at the display lists & call the rasterizers directly
+#include <Arduino.h>
+#include <XYscope.h>
+#undef private
+#include <algorithm>
+#include <vector>
+
+XYscope XYscope;
+
+typedef std::vector<uint32_t> points;	//(X << 16 | Y) per point, 12 bit values with the flags in the list kept
+
+static bool verbose = false;
+static long checks, failures, testFailures;
+
+#define CHECK(cond, ...) do { \
+		checks++; \
+		if (!(cond)) { \
+			failures++; \
+			if (verbose || testFailures++ < 5) {printf("    FAILED line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n");} \
+		} \
+	} while (0)
+
+static points listPoints(const XYscope::pointList *list, int start, int end) {
+	points p;
+	for (int i = start; i < end; i++) p.push_back(uint32_t(list[i].X) << 16 | uint16_t(list[i].Y));
+	return p;
+}
+
+static points xyList(void) {return listPoints(XYscope.XY_List, 0, XYscope.XYlistEnd);}
+
+static inline uint32_t xy(int x, int y) {return uint32_t(x & 0xfff) << 16 | (y & 0xfff);}
+
+static points coords(const points &p) {	//Just the 12 bit X & Y of each point
+	points c;
+	for (size_t i = 0; i < p.size(); i++) c.push_back(p[i] & 0x0fff0fff);
+	return c;
+}
+
+static int randIn(int lo, int hi) {return lo + rand() % (hi - lo + 1);}
+
+//=========== doubleBuffer ========================================================================
+static std::vector<points> committed;	//Points of every committed frame, in order
+static points painting;					//Points unblanked so far by the paint in progress
+static uint32_t paintsSeen;
+static size_t lastFrame;
+static long commitsMidPaint;				//plotCommit() calls made after a sliced paint had painted part of its frame
+
+static void onBeamEvent(const XYscopeSimEvent &e) {
+	if (HostSimOutput::paints != paintsSeen) {painting.clear(); paintsSeen = HostSimOutput::paints;}
+	if (e.type == HostSimOutput::SimUnblank) painting.push_back(xy(e.x, e.y));
+}
+
+static void checkPaintedFrame(void) {
+	//The frame just painted must be a whole committed frame: the latest one or one after it (never older)
+	if (painting.empty()) return;	//Nothing committed yet
+	size_t f = lastFrame;
+	while (f < committed.size() && committed[f] != painting) f++;
+	CHECK(f < committed.size(), "paint %u (%u points) is not a committed frame", HostSimOutput::paints, (unsigned) painting.size());
+	if (f < committed.size()) lastFrame = f;
+	painting.clear();
+}
+
+static void refreshTick(void) {
+	//What the refresh interrupts would do next.  With HostSimOutput::sliceRunning false a refresh paints the whole
+	//frame (all its slices back to back); with it true the slices are only pended and run here one at a time.
+	if (!HostSimOutput::sliceRunning) {
+		XYscope.initiatePioScreenPaint();
+		checkPaintedFrame();
+	} else if (!XYscope._psActive) {
+		XYscope.initiatePioScreenPaint();	//Starts the frame; its first slice is pended
+	} else if (HostSimOutput::slicePending) {
+		HostSimOutput::slicePending = false;
+		HostSimOutput::sliceIsr();
+		if (!XYscope._psActive) checkPaintedFrame();
+	}
+}
+
+static void buildFrames(int frames, int ticksPerPiece) {
+	for (int f = 0; f < frames; f++) {
+		while (XYscope._commitPending) refreshTick();	//plotStart() waits for the refresh routine to take the frame
+		XYscope.plotStart();
+		int pieces = randIn(2, 10);	//Frames of ~200 to ~4000 points: one to several slices
+		XYscope.plotPoint(f & 4095, 4095 - (f & 4095));	//Marks the frame
+		for (int k = 0; k < pieces; k++) {
+			switch (rand() % 3) {
+				case 0: XYscope.plotCircle(randIn(600, 3500), randIn(600, 3500), randIn(50, 600)); break;
+				case 1: XYscope.plotLine(randIn(0, 4095), randIn(0, 4095), randIn(0, 4095), randIn(0, 4095)); break;
+				case 2: XYscope.printSetup(randIn(0, 2000), randIn(200, 3800), randIn(60, 300)); XYscope.print((char *) "12:34"); break;
+			}
+			for (int t = randIn(0, ticksPerPiece); t > 0; t--) refreshTick();
+		}
+		if (XYscope._psActive && XYscope._ps.painted > 0) commitsMidPaint++;
+		XYscope.plotCommit();
+		committed.push_back(coords(listPoints(XYscope._pendingList, 0, XYscope._pendingEnd)));
+		for (int t = randIn(0, ticksPerPiece); t > 0; t--) refreshTick();
+	}
+}
+
+static void commitBigFrame(int mark) {	//A frame of several slices
+	XYscope.plotStart();
+	XYscope.plotPoint(mark, 4095 - mark);
+	for (int k = 0; k < 6; k++) XYscope.plotCircle(randIn(700, 3400), randIn(700, 3400), randIn(500, 600));
+	XYscope.plotCommit();
+	committed.push_back(coords(listPoints(XYscope._pendingList, 0, XYscope._pendingEnd)));
+}
+
+static int stalledFrames(int frames) {
+	//The refresh stops part way through a sliced frame while a committed frame waits: plotStart() gives up waiting,
+	//but must leave the paint in progress its list & run list (and drop the waiting frame) instead of swapping
+	int ok = 0;
+	for (int f = 0; f < frames; f++) {
+		while (XYscope._commitPending || XYscope._psActive) refreshTick();
+		commitBigFrame(4000 + f);
+		while (!(XYscope._psActive && XYscope._ps.painted > 0)) refreshTick();
+		commitBigFrame(4050 + f);
+		const XYscope::pointList *front = XYscope._paintList, *run0 = XYscope._paintRuns[0].list;
+		XYscope.plotStart();	//No refresh ticks from here on: the paint is stalled
+		bool kept = XYscope._psActive && XYscope._paintList == front && XYscope._paintRuns[0].list == run0 &&
+			XYscope.XY_List != front && !XYscope._commitPending;
+		CHECK(kept, "stalled frame %d: plotStart() swapped the lists under the paint in progress", f);
+		ok += kept;
+		XYscope.plotPoint(4095, f);	//Build the next frame while the stalled paint still holds the front list
+		for (int k = 0; k < 3; k++) XYscope.plotLine(randIn(0, 4095), randIn(0, 4095), randIn(0, 4095), randIn(0, 4095));
+		XYscope.plotCommit();
+		committed.push_back(coords(listPoints(XYscope._pendingList, 0, XYscope._pendingEnd)));
+		while (XYscope._commitPending || XYscope._psActive) refreshTick();	//Refresh runs again
+		CHECK(lastFrame == committed.size() - 1, "stalled frame %d: frame built after the stall never painted", f);
+	}
+	return ok;
+}
+
+static void testDoubleBuffer(void) {
+	if (!CFG_DoubleBufferXYlist || !CFG_SlicedPaint) {printf("    skipped: needs CFG_DoubleBufferXYlist & CFG_SlicedPaint\n"); return;}
+	srand(1);
+	XYscope.plotStart();	//Start from an empty front list, whatever the tests before left on the screen
+	XYscope.plotCommit();
+	XYscope.initiatePioScreenPaint();
+	HostSimOutput::trace = onBeamEvent;
+
+	//Whole paints between the plot calls
+	buildFrames(300, 2);
+	uint32_t wholePaints = HostSimOutput::paints;
+
+	//Sliced paints: one slice at a time between the plot calls
+	HostSimOutput::sliceRunning = true;
+	buildFrames(300, 6);
+	int stalled = stalledFrames(5);
+	while (XYscope._commitPending || XYscope._psActive) refreshTick();
+	HostSimOutput::sliceRunning = false;
+	HostSimOutput::slicePending = false;
+
+	HostSimOutput::trace = NULL;
+	CHECK(wholePaints > 100 && HostSimOutput::paints - wholePaints > 100, "too few paints (%u whole, %u sliced)",
+		wholePaints, HostSimOutput::paints - wholePaints);
+	CHECK(lastFrame == committed.size() - 1, "last committed frame never painted");
+	CHECK(commitsMidPaint > 50, "only %ld commits part way through a sliced paint", commitsMidPaint);
+	printf("    %u paints, %ld frames committed (%ld part way through a sliced paint), %d of 5 stalled paints kept their list\n",
+		HostSimOutput::paints, (long) committed.size(), commitsMidPaint, stalled);
+}
+
+//=========== segments ============================================================================
+static points traced;	//Points unblanked by one refresh
+
+static void onTrace(const XYscopeSimEvent &e) {
+	if (e.type == HostSimOutput::SimUnblank) traced.push_back(xy(e.x, e.y));
+}
+
+static points paintOnce(void) {
+	traced.clear();
+	HostSimOutput::trace = onTrace;
+	XYscope.initiatePioScreenPaint();
+	HostSimOutput::trace = NULL;
+	return traced;
+}
+
+static void segFigure(int s, int v) {	//What segment s holds in version v
+	XYscope.plotCircle(600 + s * 950, 2048 + v * 120, 250 + v * 60);
+	XYscope.plotLine(600 + s * 950, 400, 400 + s * 950 + v * 90, 3600);
+}
+
+static points segPoints(int seg) {
+	return listPoints(XYscope.XY_SegmentPool, XYscope._seg[seg].start, XYscope._seg[seg].start + XYscope._seg[seg].count);
+}
+
+static points framePoints(const points &base, const points *seg, const int *order, int n) {	//What a refresh should paint
+	points p(base);
+	for (int k = 0; k < n; k++) p.insert(p.end(), seg[order[k]].begin(), seg[order[k]].end());
+	return p;
+}
+
+static void testSegments(void) {
+	//Rebuilding, hiding or moving one segment leaves the points of the XY_List & of every other segment as they were
+	if (!CFG_SegmentPoolSize) {printf("    skipped: needs CFG_SegmentPoolSize\n"); return;}
+	const int nSeg = 4, mid = 1;
+	static const char *names[nSeg] = {"face", "hour", "minute", "second"};
+	points want[nSeg], v1, v2;
+	for (int s = 0; s < nSeg; s++) {XYscope.plotStart(); segFigure(s, 0); want[s] = coords(xyList());}
+	XYscope.plotStart(); segFigure(mid, 1); v1 = coords(xyList());
+	XYscope.plotStart(); segFigure(mid, 2); v2 = coords(xyList());
+
+	XYscope.plotStart();
+	XYscope.plotRectangle(100, 100, 3995, 3995);
+	XYscope.plotCommit();
+	points base = coords(listPoints(XYscope._pendingList, 0, XYscope._pendingEnd));
+	paintOnce();	//Picks up the committed list
+
+	int seg[nSeg];
+	points raw[nSeg];
+	for (int s = 0; s < nSeg; s++) {
+		seg[s] = XYscope.segmentCreate(names[s], 1000);
+		CHECK(seg[s] == s, "segmentCreate(\"%s\") returned %d", names[s], seg[s]);
+		if (seg[s] != s) return;
+		XYscope.segmentBegin(s);
+		segFigure(s, 0);
+		XYscope.segmentEnd();
+		raw[s] = segPoints(s);
+		CHECK(coords(raw[s]) == want[s], "segment %d: %u points, not the %u plotted", s, (unsigned) raw[s].size(),
+			(unsigned) want[s].size());
+	}
+	int order[nSeg] = {0, 1, 2, 3};
+	CHECK(paintOnce() == framePoints(base, want, order, nSeg), "segments painted after the XY_List, in order");
+
+	//Rebuild the middle segment: first in the free tail of the XY_List (copied in at segmentEnd), then in place
+	//(a commit is waiting, so the back buffer may still be painted)
+	for (int pass = 0; pass < 2; pass++) {
+		if (pass == 1) {
+			XYscope.plotStart();
+			XYscope.plotRectangle(100, 100, 3995, 3995);
+			XYscope.plotCommit();
+		}
+		XYscope.segmentBegin(mid);
+		CHECK(XYscope._segInScratch == (pass == 0), "pass %d: segment built %s", pass, XYscope._segInScratch ? "in scratch" : "in place");
+		segFigure(mid, 1 + pass);
+		XYscope.segmentEnd();
+		want[mid] = pass == 0 ? v1 : v2;
+		CHECK(coords(segPoints(mid)) == want[mid], "pass %d: rebuilt segment does not hold the new points", pass);
+		for (int s = 0; s < nSeg; s++) {
+			if (s != mid) CHECK(segPoints(s) == raw[s], "pass %d: rebuilding segment %d changed segment %d", pass, mid, s);
+		}
+		CHECK(paintOnce() == framePoints(base, want, order, nSeg), "pass %d: painted trace after the rebuild", pass);
+	}
+	raw[mid] = segPoints(mid);
+
+	//Hide it, then show it again as the last one painted
+	XYscope.segmentShow(mid, false);
+	int hidden[nSeg - 1] = {0, 2, 3};
+	CHECK(paintOnce() == framePoints(base, want, hidden, nSeg - 1), "hidden segment still painted");
+	XYscope.segmentShow(mid, true);
+	XYscope.segmentMoveTo(mid, nSeg - 1);
+	int moved[nSeg] = {0, 2, 3, 1};
+	CHECK(paintOnce() == framePoints(base, want, moved, nSeg), "segment moved to the end of the paint order");
+	for (int s = 0; s < nSeg; s++) CHECK(segPoints(s) == raw[s], "hiding & moving segment %d changed segment %d", mid, s);
+	printf("    %d segments, middle one rebuilt twice (%u then %u points), hidden & moved\n", nSeg, (unsigned) v1.size(),
+		(unsigned) v2.size());
+}
+
+//=========== beamPath ============================================================================
+static int largeSteps(const points &p) {	//Points tagged SettleLong_flag
+	int n = 0;
+	for (size_t i = 0; i < p.size(); i++) n += (p[i] >> 16 & XYscope::SettleLong_flag) != 0;
+	return n;
+}
+
+static points sorted(const points &p) {
+	points s(p);
+	std::sort(s.begin(), s.end());
+	return s;
+}
+
+static void scatterScene(int seed) {	//Small figures all over the screen, in random order
+	srand(seed);
+	for (int k = 0; k < 80; k++) {
+		int x = randIn(300, 3700), y = randIn(300, 3700);
+		switch (rand() % 3) {
+			case 0: XYscope.plotCircle(x, y, randIn(20, 150)); break;
+			case 1: XYscope.plotLine(x, y, x + randIn(-150, 150), y + randIn(-150, 150)); break;
+			case 2: XYscope.printSetup(x, y, 100); XYscope.print((char *) "7"); break;
+		}
+	}
+}
+
+static void testBeamPath(void) {
+	//The re-ordered list paints the same points as the list as plotted, with no more Large Steps & no more paint time
+	if (!CFG_BeamPathOptimizer) {printf("    skipped: needs CFG_BeamPathOptimizer\n"); return;}
+	long stepsBefore = 0, stepsAfter = 0, jumpsSaved = 0;
+	for (int t = 0; t < 20; t++) {
+		XYscope.setBeamPathOptimizer(false);
+		XYscope.plotStart();
+		scatterScene(t);
+		XYscope.plotCommit();
+		points plain = listPoints(XYscope._pendingList, 0, XYscope._pendingEnd);
+		HostSimOutput::reset();
+		points plainPaint = paintOnce();
+		uint64_t plainPs = HostSimOutput::now_ps;
+
+		XYscope.setBeamPathOptimizer(true, 60000);	//Budget big enough that every list is finished on a slow host
+		XYscope.plotStart();
+		scatterScene(t);
+		XYscope.plotCommit();
+		points optimized = listPoints(XYscope._pendingList, 0, XYscope._pendingEnd);
+		HostSimOutput::reset();
+		points optimizedPaint = paintOnce();
+
+		CHECK(sorted(coords(optimized)) == sorted(coords(plain)), "scene %d: re-ordered list holds other points", t);
+		CHECK(sorted(optimizedPaint) == sorted(plainPaint), "scene %d: re-ordered list paints other points", t);
+		CHECK(largeSteps(optimized) <= largeSteps(plain), "scene %d: %d Large Steps, %d before", t, largeSteps(optimized),
+			largeSteps(plain));
+		CHECK(HostSimOutput::now_ps <= plainPs, "scene %d: paint takes longer", t);
+		stepsBefore += largeSteps(plain);
+		stepsAfter += largeSteps(optimized);
+		jumpsSaved += XYscope.getBeamPathJumpsSaved();
+	}
+	CHECK(stepsAfter < stepsBefore, "no Large Steps saved");
+	printf("    20 scenes: %ld Large Steps -> %ld (%ld jumps saved)\n", stepsBefore, stepsAfter, jumpsSaved);
+}
+
+//=========== lod =================================================================================
+static void paints(int n, uint8_t *levels) {	//n whole refreshes of the current frame; the LOD level of each
+	for (int i = 0; i < n; i++) {
+		XYscope.initiatePioScreenPaint();
+		if (levels) levels[i] = XYscope.getLodLevel();
+	}
+}
+
+static bool steady(const uint8_t *levels, int n) {
+	for (int i = 1; i < n; i++) if (levels[i] != levels[0]) return false;
+	return true;
+}
+
+static uint32_t lodPredictUs(uint8_t level) {	//What lodSelect() predicts for the next frame at a LOD level
+	uint32_t points[XYscope::LodLowestPriority + 1], largeSteps, n = 0;
+	XYscope.nextFrameCost(points, largeSteps);
+	for (int p = 0; p <= XYscope::LodLowestPriority; p++) {
+		int shift = min(max(level + p - XYscope::LodLowestPriority, 0), (int) XYscope::LodMaxStrideShift);	//lodShift()
+		n += points[p] >> shift;
+	}
+	return XYscope.paintCostUs(n, largeSteps, XYscope._costGainQ16);
+}
+
+static void testLod(void) {
+	//A frame too big for the LOD period: the level settles & stays put, the period is held and the paint fits it
+	const uint32_t computeUs = XYscope.TNSY_3_6_MinComputeTimeUs;
+	const int settle = 20, hold = 40;
+	uint8_t levels[hold];
+	XYscope.plotStart();
+	for (int k = 0; k < 12; k++) XYscope.plotCircle(2048, 2048, 1000 + k * 80);
+	XYscope.plotCommit();
+	int seg = XYscope.segmentCreate("detail", 3000);
+	XYscope.segmentBegin(seg);
+	for (int k = 0; k < 5; k++) XYscope.plotCircle(2048, 2048, 300 + k * 150);
+	XYscope.segmentEnd();
+	XYscope.segmentPriority(seg, XYscope::LodLowestPriority);	//Thinned first
+	XYscope.setLodRefreshUs(0);
+	paints(settle, NULL);
+	uint32_t fullUs = XYscope.act_PaintTimeDurationUs;
+
+	//Period 60% of the full paint: thinned, not stretched
+	uint32_t periodUs = fullUs * 6 / 10 + computeUs;
+	XYscope.setLodRefreshUs(periodUs);
+	paints(settle, NULL);
+	paints(hold, levels);
+	uint8_t level = levels[0];
+	CHECK(steady(levels, hold), "level flaps between paints of the same frame");
+	CHECK(level > 0, "frame 1.7 times the period painted in full");
+	CHECK((uint32_t) XYscope.getRefreshPeriodUs() == periodUs, "period stretched to %ld us (LOD period %u us)",
+		XYscope.getRefreshPeriodUs(), periodUs);
+	CHECK(XYscope.act_PaintTimeDurationUs <= periodUs - computeUs, "thinned paint takes %u us, more than %u us",
+		(unsigned) XYscope.act_PaintTimeDurationUs, periodUs - computeUs);
+	uint32_t dropped = XYscope.getLodPointsDropped();
+	CHECK(dropped > 0, "no points dropped at level %d", level);
+
+	//Hysteresis: the level below now fits, but with less than 1/16 of the budget to spare, so the level stays
+	uint32_t belowUs = lodPredictUs(level - 1);
+	XYscope.setLodRefreshUs(belowUs + belowUs / 32 + computeUs);
+	paints(hold, levels);
+	CHECK(steady(levels, hold) && levels[0] == level, "level %d -> %d with the level below just fitting", level, levels[0]);
+
+	//Plenty of room: back to full detail
+	XYscope.setLodRefreshUs(fullUs * 2 + computeUs);
+	paints(settle, levels);
+	CHECK(levels[settle - 1] == 0 && XYscope.getLodPointsDropped() == 0, "level %d with room for the full frame", levels[settle - 1]);
+	XYscope.setLodRefreshUs(0);
+	printf("    full paint %u us; LOD period %u us holds level %d (%u points dropped)\n", (unsigned) fullUs, periodUs, level,
+		(unsigned) dropped);
+}
+
+//=========== costGain ============================================================================
+static float gainMin, gainMax;
+
+static float gainAfter(int n) {	//Paint the current frame n times; gain after the last, lowest & highest on the way
+	for (int i = 0; i < n; i++) {
+		XYscope.initiatePioScreenPaint();
+		gainMin = min(gainMin, XYscope.getPaintCostGain());
+		gainMax = max(gainMax, XYscope.getPaintCostGain());
+	}
+	return XYscope.getPaintCostGain();
+}
+
+static void testCostGain(void) {
+	//The gain settles near 1.0 for the simulated TEENSY, follows a slower or faster board and never leaves 0.25..4
+	const uint32_t dacPs = HostSimOutput::dacWrite_ps, pinPs = HostSimOutput::pinWrite_ps, cyclePs = HostSimOutput::cycle_ps;
+	XYscope.plotStart();
+	for (int k = 0; k < 10; k++) XYscope.plotCircle(2048, 2048, 300 + k * 150);
+	XYscope.plotLine(0, 0, 4095, 4095);
+	XYscope.plotCommit();
+	gainMin = 1e9;
+	gainMax = 0;
+	float settled = gainAfter(30);
+	CHECK(fabs(settled - 1.0) < .05, "gain %.3f for the board CFG_PioPointCycles was calibrated on", settled);
+	uint32_t predictedUs = XYscope.paintCostUs(XYscope._paintPointCount, XYscope._paintLargeCount, XYscope._costGainQ16);
+	CHECK(abs(int(predictedUs) - int(XYscope.act_PaintTimeDurationUs)) <= int(XYscope.act_PaintTimeDurationUs) / 50 + 1,
+		"predicted %u us, painted in %u us", predictedUs, (unsigned) XYscope.act_PaintTimeDurationUs);
+
+	HostSimOutput::cycle_ps = cyclePs * 20;		//A board 20 times slower: clamped at 4
+	HostSimOutput::dacWrite_ps = dacPs * 20;
+	HostSimOutput::pinWrite_ps = pinPs * 20;
+	float slow = gainAfter(30);
+	CHECK(slow > 3.99 && slow <= 4.0, "gain %.3f for a board 20 times slower (limit 4)", slow);
+	HostSimOutput::cycle_ps = 1;				//A board that paints in no time: clamped at 0.25
+	HostSimOutput::dacWrite_ps = 0;
+	HostSimOutput::pinWrite_ps = 0;
+	float fast = gainAfter(30);
+	CHECK(fast >= .25 && fast < .26, "gain %.3f for a board that paints in no time (limit 0.25)", fast);
+	HostSimOutput::cycle_ps = cyclePs;
+	HostSimOutput::dacWrite_ps = dacPs;
+	HostSimOutput::pinWrite_ps = pinPs;
+	float back = gainAfter(40);
+	CHECK(fabs(back - settled) < .01, "gain %.3f back on the first board (%.3f before)", back, settled);
+	CHECK(gainMin >= .25 && gainMax <= 4.0, "gain went from %.3f to %.3f", gainMin, gainMax);
+	printf("    gain %.3f, slow board %.3f, fast board %.3f, back %.3f\n", settled, slow, fast, back);
+}
+
+//=========== telemetry ===========================================================================
+static void addFrame(uint32_t paintUs, uint32_t jitterUs) {	//A frame record as pioPaintFinish() adds it
+	XYscope.act_PaintTimeDurationUs = paintUs;
+	XYscope._frameJitterUs = jitterUs;
+	XYscope._jitterExpectedUs = 20000;
+	XYscope.frameRecordAdd(100, 1);
+}
+
+static void testTelemetry(void) {
+	//Nearest rank percentiles over a known frame sequence; the ring keeps the last CFG_TelemetryFrames frames
+	if (CFG_TelemetryFrames < 21) {printf("    skipped: needs CFG_TelemetryFrames of 21 or more\n"); return;}
+	XYscope::frameStats st;
+	XYscope::frameRecord r;
+	XYscope.resetTelemetry();
+	XYscope.getFrameStats(st);
+	CHECK(XYscope.getFrameCount() == 0 && st.frames == 0 && st.paintMaxUs == 0 && st.jitterMaxUs == 0, "empty ring has statistics");
+
+	//Paint times 100..2000 us & jitters 1..20 us, shuffled.  Last 10 frames: 3, 4, 6, 8, 10, 12, 13, 15, 17, 18
+	static const uint8_t seq[20] = {7, 19, 2, 14, 11, 20, 5, 16, 1, 9, 3, 18, 12, 6, 15, 8, 13, 4, 17, 10};
+	for (int i = 0; i < 20; i++) addFrame(seq[i] * 100, seq[i]);
+	XYscope.getFrameStats(st);
+	CHECK(st.frames == 20 && st.overruns == 0, "%u frames, %u overruns", st.frames, st.overruns);
+	CHECK(st.paintP50Us == 1000 && st.paintP95Us == 1900 && st.paintP99Us == 2000 && st.paintMaxUs == 2000,
+		"paint p50/p95/p99/max %u/%u/%u/%u us, not 1000/1900/2000/2000", st.paintP50Us, st.paintP95Us, st.paintP99Us, st.paintMaxUs);
+	CHECK(st.jitterP50Us == 10 && st.jitterP95Us == 19 && st.jitterP99Us == 20 && st.jitterMaxUs == 20,
+		"jitter p50/p95/p99/max %u/%u/%u/%u us, not 10/19/20/20", st.jitterP50Us, st.jitterP95Us, st.jitterP99Us, st.jitterMaxUs);
+	XYscope::frameStats known = st;
+	XYscope.getFrameStats(st, 10);
+	CHECK(st.frames == 10 && st.paintP50Us == 1000 && st.paintP95Us == 1800 && st.paintMaxUs == 1800 && st.jitterP95Us == 18,
+		"last 10 frames: %u frames, paint p50/p95/max %u/%u/%u us, jitter p95 %u us", st.frames, st.paintP50Us, st.paintP95Us,
+		st.paintMaxUs, st.jitterP95Us);
+	CHECK(XYscope.getFrameRecord(0, r) && r.paintUs == 1000 && r.jitterUs == 10, "last frame record");
+	CHECK(XYscope.getFrameRecord(19, r) && r.paintUs == 700 && !XYscope.getFrameRecord(20, r), "oldest frame record");
+
+	//A paint longer than the refresh period is an overrun
+	addFrame(25000, 0);
+	XYscope.getFrameStats(st);
+	CHECK(st.frames == 21 && st.overruns == 1 && st.paintMaxUs == 25000, "%u overruns after a 25 ms paint", st.overruns);
+
+	//The ring wraps: only the last CFG_TelemetryFrames frames are held, newest first
+	for (int i = 0; i < CFG_TelemetryFrames + 10; i++) addFrame(1000 + i, 0);
+	bool inOrder = XYscope.getFrameCount() == CFG_TelemetryFrames && !XYscope.getFrameRecord(CFG_TelemetryFrames, r);
+	for (int age = 0; age < CFG_TelemetryFrames && inOrder; age++)
+		inOrder = XYscope.getFrameRecord(age, r) && r.paintUs == uint32_t(1000 + CFG_TelemetryFrames + 9 - age);
+	CHECK(inOrder, "ring after %d frames", CFG_TelemetryFrames + 10);
+
+	//Real paints are recorded with their simulated paint time & points
+	XYscope.resetTelemetry();
+	XYscope.plotStart();
+	XYscope.plotCircle(2048, 2048, 1500);
+	XYscope.plotCommit();
+	for (int i = 0; i < 5; i++) XYscope.initiatePioScreenPaint();
+	CHECK(XYscope.getFrameCount() == 5 && XYscope.getFrameRecord(0, r) && r.paintUs == XYscope.act_PaintTimeDurationUs &&
+		r.points == uint32_t(XYscope.act_NumPointsPlotted) && r.points > 0, "records of 5 paints");
+	printf("    paint p50/p95/p99/max over 20 known frames: %u/%u/%u/%u us\n", known.paintP50Us, known.paintP95Us,
+		known.paintP99Us, known.paintMaxUs);
+}
+
+//=========== primitives ==========================================================================
+static points primPoints(void) {	//What the paint loop rasterizes from the primitive list
+	points p;
+	short X, Y;
+	XYscope.primRasterStart();
+	while (XYscope.primNextPoint(X, Y)) p.push_back(xy(X, Y));
+	return p;
+}
+
+static bool near(const points &a, const points &b, int counts) {
+	//Every point of a is within 'counts' (X & Y) of some point of b
+	points sorted(b);
+	std::sort(sorted.begin(), sorted.end());
+	for (size_t i = 0; i < a.size(); i++) {
+		int x = a[i] >> 16, y = a[i] & 0xfff;
+		bool found = false;
+		for (int dx = -counts; dx <= counts && !found; dx++) for (int dy = -counts; dy <= counts && !found; dy++)
+			found = std::binary_search(sorted.begin(), sorted.end(), xy(x + dx, y + dy));
+		if (!found) return false;
+	}
+	return true;
+}
+
+static void testPrimitives(void) {
+	//Lines & arcs give the same points.  Glyph vertices are rounded differently and can be a count off; a stroke
+	//that comes out a count longer can then get one more point, up to one point spacing (density + 1) away.
+	if (!CFG_PrimitiveDisplayList) {printf("    skipped: needs CFG_PrimitiveDisplayList\n"); return;}
+	srand(2);
+	XYscope.setActiveFont(_HersheyFont);
+	for (int t = 0; t < 2000; t++) {
+		XYscope._graphDensity = rand() % 20;
+		XYscope._textDensity = rand() % 8;
+		int x0 = randIn(0, 4095), y0 = randIn(0, 4095), x1 = randIn(0, 4095), y1 = randIn(0, 4095);
+		int r = randIn(1, 1500), r2 = randIn(1, 1500), ht = randIn(20, 400);
+		uint8_t arcs = rand() % 2 ? 255 : rand() % 256;
+		int tx = randIn(0, 3000), ty = randIn(0, 3800);
+		const char *text = rand() % 2 ? "Hello 12:34" : "XYscope gjpqy";
+		for (int k = 0; k < 5; k++) {
+			XYscope.plotStart();
+			XYscope.primClear();
+			switch (k) {
+				case 0: XYscope.plotLine(x0, y0, x1, y1); XYscope.primLine(x0, y0, x1, y1); break;
+				case 1:
+					XYscope.plotRectangle(min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1));
+					XYscope.primRectangle(min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1));
+					break;
+				case 2: XYscope.plotEllipse(x0, y0, r, r2, arcs); XYscope.primEllipse(x0, y0, r, r2, arcs); break;
+				case 3: XYscope.plotCircle(x1, y1, r); XYscope.primCircle(x1, y1, r); break;
+				case 4:
+					XYscope.printSetup(tx, ty, ht);
+					XYscope.print((char *) text);
+					XYscope.printSetup(tx, ty, ht);
+					XYscope.primPrint(text);
+					break;
+			}
+			points list = coords(xyList()), prim = primPoints();
+			if (k < 4) CHECK(prim == list, "scene %d figure %d: %u primitive points vs %u XY_List points", t, k,
+				(unsigned) prim.size(), (unsigned) list.size());
+			else CHECK(abs(int(prim.size()) - int(list.size())) <= (int) strlen(text) && near(prim, list, XYscope._textDensity + 1) && near(list, prim, XYscope._textDensity + 1),
+				"scene %d '%s' size %d: %u primitive points vs %u XY_List points", t, text, ht, (unsigned) prim.size(), (unsigned) list.size());
+		}
+	}
+}
+
+//=========== hershey =============================================================================
+static const uint64_t hersheyGolden = 0x8ff91bf4e9b6bb93ULL;
+
+static void testHershey(void) {
+	char all[96];
+	for (int c = 32; c < 127; c++) all[c - 32] = c;
+	all[95] = 0;
+	const short sizes[4] = {40, 150, 333, 900}, spacings[4] = {0, 8, 10, 12};
+	uint64_t h = 1469598103934665603ULL;
+	for (int font = 0; font < 2; font++) {
+		XYscope.setActiveFont(font ? _HersheyFont : _VectorFont);
+		for (int sz = 0; sz < 4; sz++) for (int sp = 0; sp < 4; sp++) {
+			XYscope.setFontSpacing(spacings[sp]);
+			for (int c = 32; c < 128; c++) {	//Each character alone, then all of them (127 is undefined)
+				char one[2] = {char(c), 0};
+				char *text = c < 127 ? one : all;
+				XYscope.plotStart();
+				XYscope.printSetup(0, 2048, sizes[sz]);
+				XYscope.print(text);
+				int advance = XYscope.charX;
+				XYscope.printSetup(0, 2048, sizes[sz]);
+				if (c < 127) CHECK(XYscope.getTextWidth(text) == advance, "font %d size %d spacing %d '%c': getTextWidth %d, print() advance %d",
+					font, sizes[sz], spacings[sp], c, XYscope.getTextWidth(text), advance);
+				points p = xyList();
+				for (size_t i = 0; i < p.size(); i++) h = (h ^ p[i]) * 1099511628211ULL;
+				h = (h ^ p.size()) * 1099511628211ULL;
+			}
+		}
+	}
+	//Checksum of the packed font's output, which gave the same points as the original font ROMs.  Change it only
+	//when the glyph points are meant to change.
+	CHECK(h == hersheyGolden, "print() checksum %016llx, expected %016llx", (unsigned long long) h, (unsigned long long) hersheyGolden);
+}
+
+//=========== lineStepper =========================================================================
+static points bresenham(int x0, int y0, int x1, int y1, int density) {	//plotLine before the line stepper
+	points p;
+	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+	int dy = abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+	int err = (dx > dy ? dx : -dy) / 2, e2;
+	int skip = 0;
+	for (;;) {
+		if (skip <= 0) {p.push_back(xy(x0, y0)); skip = density;}
+		else skip--;
+		if (x0 == x1 && y0 == y1) break;
+		e2 = err;
+		if (e2 > -dx) {err -= dy; x0 += sx;}
+		if (e2 < dy) {err += dx; y0 += sy;}
+	}
+	return p;
+}
+
+static void testLineStepper(void) {
+	srand(3);
+	long differ = 0, total = 0;
+	for (int t = 0; t < 20000; t++) {
+		int x0 = randIn(0, 4095), y0 = randIn(0, 4095), x1, y1;
+		if (t % 4 == 0) {x1 = min(4095, max(0, x0 + randIn(-20, 20))); y1 = min(4095, max(0, y0 + randIn(-20, 20)));}	//Glyph size
+		else {x1 = randIn(0, 4095); y1 = randIn(0, 4095);}
+		int density = rand() % 31;
+		XYscope._graphDensity = density;
+		XYscope.plotStart();
+		XYscope.plotLine(x0, y0, x1, y1);
+		points p = coords(xyList()), b = bresenham(x0, y0, x1, y1, density);
+		CHECK(p.size() == b.size(), "line %d,%d %d,%d density %d: %u points, Bresenham %u", x0, y0, x1, y1, density,
+			(unsigned) p.size(), (unsigned) b.size());
+		if (p.size() != b.size()) continue;
+		bool xMajor = abs(x1 - x0) > abs(y1 - y0);
+		for (size_t i = 0; i < p.size(); i++) {
+			int px = p[i] >> 16, py = p[i] & 0xfff, bx = b[i] >> 16, by = b[i] & 0xfff;
+			bool ok = xMajor ? (px == bx && abs(py - by) <= 1) : (py == by && abs(px - bx) <= 1);
+			CHECK(ok, "line %d,%d %d,%d density %d point %u: %d,%d vs Bresenham %d,%d", x0, y0, x1, y1, density, (unsigned) i, px, py, bx, by);
+			differ += p[i] != b[i];
+		}
+		total += p.size();
+	}
+	printf("    %ld of %ld points differ from Bresenham by one count\n", differ, total);
+}
+
+//=========== glyphCache ==========================================================================
+static void testGlyphCache(void) {
+	if (CFG_GlyphCacheBytes == 0) {printf("    skipped: needs CFG_GlyphCacheBytes\n"); return;}
+	srand(4);
+	const char *words[] = {"12:34", "Hello, World!", "XYscope 3.14159", "~`{}|", "gjpqy_", "The quick brown fox 0123456789"};
+	const short spacings[4] = {0, 8, 10, 12};
+	XYscope.glyphCacheClear();
+	for (int t = 0; t < 3000; t++) {
+		XYscope.setActiveFont(rand() % 2 ? _HersheyFont : _VectorFont);
+		XYscope.setFontSpacing(spacings[rand() % 4]);
+		XYscope._textDensity = rand() % 6;
+		int ht = rand() % 3 == 0 ? randIn(16, 1200) : randIn(40, 240);
+		int x = rand() % 5 == 0 ? randIn(-4100, 4100) : randIn(0, 4095);
+		int y = rand() % 5 == 0 ? randIn(-4100, 4100) : randIn(0, 4095);
+		const char *text = words[rand() % 6];
+
+		XYscope.plotStart();
+		int cx = x, cy = y, ch = ht;
+		for (const char *c = text; *c; c++) XYscope.plotChar(*c, cx, cy, ch);
+		points cached = xyList();
+		uint32_t cachedLarge = XYscope._buildLargeSteps;
+
+		XYscope.plotStart();
+		int dx = x, dy = y, dh = ht;
+		for (const char *c = text; *c; c++) {
+			if (XYscope.ActiveFont == _VectorFont) XYscope.plotChar_V(*c, dx, dy, dh);
+			else XYscope.plotChar_H(*c, dx, dy, dh);
+		}
+		CHECK(cached == xyList() && cachedLarge == XYscope._buildLargeSteps && cx == dx && cy == dy,
+			"'%s' at %d,%d size %d font %d: %u cached points vs %u rasterized", text, x, y, ht, XYscope.ActiveFont,
+			(unsigned) cached.size(), (unsigned) XYscope.XYlistEnd);
+	}
+	CHECK(XYscope.getGlyphCacheHits() > 0, "cache hits %u, misses %u",
+		XYscope.getGlyphCacheHits(), XYscope.getGlyphCacheMisses());
+}
+
+//=========== sprites =============================================================================
+static void star(int xc, int yc) {
+	static const int X[5] = {0, 285, 176, -176, -285}, Y[5] = {300, 92, -243, -243, 92};
+	for (int i = 0; i < 5; i++) XYscope.plotLine(X[i] + xc, Y[i] + yc, X[(i + 2) % 5] + xc, Y[(i + 2) % 5] + yc);
+	XYscope.plotCircle(xc, yc, 100);
+}
+
+static void testSprites(void) {
+	if (!XYscope.SpritesOn) {printf("    skipped: needs CFG_MaxSprites & CFG_SpritePoolSize\n"); return;}
+	srand(5);
+	XYscope.spriteDeleteAll();
+	XYscope.plotStart();
+	XYscope.plotLine(0, 0, 100, 100);
+	points before = xyList();
+	uint32_t beforeLarge = XYscope._buildLargeSteps;
+	XYscope.spriteBegin(2048, 2048);
+	XYscope.plotCircle(2048, 2048, 75);
+	int ball = XYscope.spriteEnd();
+	XYscope.spriteBegin(2048, 2048);
+	star(2048, 2048);
+	int shape = XYscope.spriteEnd();
+	CHECK(ball >= 0 && shape >= 0, "spriteEnd() returned %d, %d", ball, shape);
+	CHECK(xyList() == before && XYscope._buildLargeSteps == beforeLarge, "recording a sprite changed the list");
+	if (ball < 0 || shape < 0) return;
+
+	for (int t = 0; t < 2000; t++) {
+		int x = randIn(-250, 4350), y = randIn(-250, 4350);	//Some partly off screen
+		XYscope.plotStart();
+		XYscope.plotPoint(5, 5);
+		XYscope.plotCircle(x, y, 75);
+		star(x, y + 500);
+		points drawn = xyList();
+		uint32_t drawnLarge = XYscope._buildLargeSteps;
+		XYscope.plotStart();
+		XYscope.plotPoint(5, 5);
+		XYscope.spriteStamp(ball, x, y);
+		XYscope.spriteStamp(shape, x, y + 500);
+		CHECK(xyList() == drawn && XYscope._buildLargeSteps == drawnLarge, "stamped at %d,%d: %u points vs %u drawn", x, y,
+			(unsigned) XYscope.XYlistEnd, (unsigned) drawn.size());
+	}
+	XYscope.spriteDeleteAll();
+}
+
+//=========== transform ===========================================================================
+static void testTransform(void) {
+	srand(6);
+	XYscope.resetTransform();
+	XYscope.rotate(0);
+	XYscope.scale(1);
+	XYscope.translate(0, 0);
+	CHECK(!XYscope._xfOn, "identity transform is not detected");
+	for (int t = 0; t < 500; t++) {
+		int dx = randIn(-500, 500), dy = randIn(-500, 500), x = randIn(1000, 3000), y = randIn(1000, 3000), r = randIn(10, 400);
+		XYscope.plotStart();
+		XYscope.plotLine(x, y, x + r, y - r / 2);
+		XYscope.plotCircle(x, y, r);
+		XYscope.plotEllipse(x, y, r, r / 2, 0x5a);
+		points plain = coords(xyList());
+		XYscope.plotStart();
+		XYscope.pushTransform();
+		XYscope.translate(dx, dy);
+		XYscope.plotLine(x - dx, y - dy, x + r - dx, y - r / 2 - dy);
+		XYscope.plotCircle(x - dx, y - dy, r);
+		XYscope.plotEllipse(x - dx, y - dy, r, r / 2, 0x5a);
+		XYscope.popTransform();
+		CHECK(coords(xyList()) == plain, "translated by %d,%d: %u points vs %u", dx, dy, (unsigned) XYscope.XYlistEnd, (unsigned) plain.size());
+	}
+	XYscope.plotStart();
+	XYscope.translate(2048, 2048);
+	XYscope.rotate(45);
+	XYscope.plotRectangle(-1000, -1000, 1000, 1000);
+	XYscope.resetTransform();
+	int xMax = 0;
+	points p = coords(xyList());
+	for (size_t i = 0; i < p.size(); i++) xMax = max(xMax, abs(int(p[i] >> 16) - 2048));
+	CHECK(abs(xMax - 1414) <= 1, "square rotated 45 degrees: X extent %d, expected 1414", xMax);
+	CHECK(XYscope._xfDepth == 0, "transform stack depth %d after resetTransform", XYscope._xfDepth);
+}
+
+//=========== clipping ============================================================================
+static points unclippedLine(int x0, int y0, int x1, int y1, int density) {
+	//Every point of the whole line (as lineStepStart steps it), keeping the on-screen ones
+	points p;
+	int dx = abs(x1 - x0), dy = abs(y1 - y0), stride = density + 1;
+	bool xMajor = dx > dy;
+	int64_t major = xMajor ? dx : dy, minor = xMajor ? dy : dx;
+	int majorSign = (xMajor ? x0 < x1 : y0 < y1) ? 1 : -1, minorSign = (xMajor ? y0 < y1 : x0 < x1) ? 1 : -1;
+	for (int64_t k = 0; k <= major / stride; k++) {
+		int64_t a = k * stride, b = major ? (2 * a * minor + major) / (2 * major) : 0;
+		int64_t x = xMajor ? x0 + majorSign * a : x0 + minorSign * b;
+		int64_t y = xMajor ? y0 + minorSign * b : y0 + majorSign * a;
+		if (x >= 0 && x <= 4095 && y >= 0 && y <= 4095) p.push_back(xy(int(x), int(y)));
+	}
+	return p;
+}
+
+static int offScreen(void) {
+	switch (rand() % 3) {
+		case 0: return randIn(-20000, 20000);
+		case 1: return randIn(-200, 4300);
+		default: return randIn(0, 4095);
+	}
+}
+
+static void testClipping(void) {
+	srand(7);
+	for (int t = 0; t < 200000; t++) {
+		int x0 = offScreen(), y0 = offScreen(), x1 = offScreen(), y1 = offScreen();
+		int density = rand() % 4 ? rand() % 20 : rand() % 100;
+		XYscope._graphDensity = density;
+		XYscope.plotStart();
+		XYscope.plotLine(x0, y0, x1, y1);
+		points p = coords(xyList());
+		CHECK(p == unclippedLine(x0, y0, x1, y1, density), "line %d,%d %d,%d density %d: %u points", x0, y0, x1, y1, density,
+			(unsigned) p.size());
+	}
+	if (CFG_PrimitiveDisplayList) {	//Primitive ellipses still drop off-screen points one by one as they are painted
+		for (int t = 0; t < 4000; t++) {
+			int x = randIn(-3000, 7000), y = randIn(-3000, 7000), xr = randIn(1, 5000), yr = rand() % 2 ? xr : randIn(1, 5000);
+			uint8_t arcs = rand() % 3 ? 255 : rand() % 256;
+			XYscope._graphDensity = rand() % 20;
+			XYscope.plotStart();
+			XYscope.plotEllipse(x, y, xr, yr, arcs);
+			points p = coords(xyList());
+			XYscope.primClear();
+			XYscope.primEllipse(x, y, xr, yr, arcs);
+			CHECK(p == primPoints(), "ellipse %d,%d %dx%d arcs %02x: %u points, %u unclipped", x, y, xr, yr, arcs, (unsigned) p.size(),
+				(unsigned) primPoints().size());
+		}
+	}
+}
+
+//=================================================================================================
+struct testEntry {
+	const char *name;
+	void (*fn)(void);
+};
+
+int main(int argc, char **argv) {
+	for (int a = 1; a < argc; a++) {
+		if (strcmp(argv[a], "-v") == 0) verbose = true;
+		else {fprintf(stderr, "usage: %s [-v]\n", argv[0]); return 1;}
+	}
+	XYscope.begin();
+	XYscope.setScreenSaveSecs(0);	//Screen saver would stop the paints
+	const testEntry tests[] = {
+		{"primitives", testPrimitives},
+		{"hershey", testHershey},
+		{"lineStepper", testLineStepper},
+		{"glyphCache", testGlyphCache},
+		{"sprites", testSprites},
+		{"transform", testTransform},
+		{"clipping", testClipping},
+		{"segments", testSegments},
+		{"beamPath", testBeamPath},
+		{"lod", testLod},
+		{"costGain", testCostGain},
+		{"telemetry", testTelemetry},
+		{"doubleBuffer", testDoubleBuffer},
+	};
+	int failed = 0;
+	for (size_t t = 0; t < sizeof(tests) / sizeof(tests[0]); t++) {
+		printf("%s\n", tests[t].name);
+		XYscope.setGraphicsIntensity(100);	//Every test starts from the same state
+		XYscope.setTextIntensity(100);
+		XYscope.setActiveFont(_VectorFont);
+		XYscope.setFontSpacing(0);
+		XYscope.resetTransform();
+		XYscope.primClear();
+		XYscope.segmentDeleteAll();
+		XYscope.setBeamPathOptimizer(false);
+		long before = failures;
+		testFailures = 0;
+		tests[t].fn();
+		if (failures > before) {printf("    %ld checks FAILED\n", failures - before); failed++;}
+	}
+	printf("%ld checks, %ld failed: %s\n", checks, failures, failed ? "FAIL" : "PASS");
+	return failed ? 1 : 0;
+}
@@ -3,589 +3,370 @@
 
 /*
 
-This data table is constructed as 48 end point coordinate x,y pairs.
+Packed HERSHEY (simplex) font.  Each character is a run of vertices in HersheyVertexStream[].
 Characters are constructed by drawing vectors between adjacent x,y pairs.
-No point (or line) is plotted if one or both of the coordinates are negative.
+A single HersheyPenUp (-128) byte in place of an x,y pair lifts the pen: no vector is drawn
+between the vertices on either side of it.  (-128 is never a valid coordinate.)
 The 25x25 Character cell starts on the lower left and goes up & to the right.
 
-The first entry   simplex[char_code-32,0]=the number of character indices in the character
-The second entry  simplex[char_code-32,1]=the width of the character
+HersheyGlyphIndex[char_code-32].Offset = index of the character's first byte in HersheyVertexStream[]
+HersheyGlyphIndex[char_code-32].Length = number of bytes (coordinates + pen-up markers) in the character
+HersheyGlyphIndex[char_code-32].Width  = the width of the character
+HersheyGlyphIndex[char_code-32].CellLeft, .CellRight, .Advance = precomputed cell metrics used to
+	space & center characters (and measure strings) without scanning the vertices.
+
+The HersheyGlyphIndex[] table is generated: after changing HersheyVertexStream[], run
+	python3 extra/hershey_metrics.py
+
+20261017	Table made static const (PROGMEM) and included at file scope so it lives in flash, not in the XYscope object
+20261017	Packed format: replaces HersheyFontROM[95][112] (glyphs padded to 112 bytes with -1,-1 pen-up pairs)
+20261017	Added precomputed cell metrics (CellLeft, CellRight, Advance) to HersheyGlyphIndex[]
 
 */
 
 #ifndef HERSHEYFONTROM_H_	//#include Guard
 	#define HERSHEYFONTROM_H_
-	int8_t HersheycharHt = 38;		//was 25...
-	int8_t HersheyFontROM[95][112] PROGMEM = {
-	{    0,16,  // [space]   ASCII 32
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,10,  // !   ASCII 33
-		5,21, 5, 7,-1,-1, 5, 2, 4, 1, 5, 0, 6, 1, 5, 2,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,16,  // "   ASCII 34
-		4,21, 4,14,-1,-1,12,21,12,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,21,  // #   ASCII 35
-	   11,25, 4,-7,-1,-1,17,25,10,-7,-1,-1, 4,12,18,12,-1,-1, 3, 6,17, 6,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   26,20,  // $   ASCII 36
-		8,25, 8,-4,-1,-1,12,25,12,-4,-1,-1,17,18,15,20,12,21, 8,21, 5,20, 3,
-	   18, 3,16, 4,14, 5,13, 7,12,13,10,15, 9,16, 8,17, 6,17, 3,15, 1,12, 0,
-		8, 0, 5, 1, 3, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   31,24,  // %   ASCII 37
-	   21,21, 3, 0,-1,-1, 8,21,10,19,10,17, 9,15, 7,14, 5,14, 3,16, 3,18, 4,
-	   20, 6,21, 8,21,10,20,13,19,16,19,19,20,21,21,-1,-1,17, 7,15, 6,14, 4,
-	   14, 2,16, 0,18, 0,20, 1,21, 3,21, 5,19, 7,17, 7,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   34,26,  // &   ASCII 38
-	   23,12,23,13,22,14,21,14,20,13,19,11,17, 6,15, 3,13, 1,11, 0, 7, 0, 5,
-		1, 4, 2, 3, 4, 3, 6, 4, 8, 5, 9,12,13,13,14,14,16,14,18,13,20,11,21,
-		9,20, 8,18, 8,16, 9,13,11,10,16, 3,18, 1,20, 0,22, 0,23, 1,23, 2,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    7,10,  // '   ASCII 39
-		5,19, 4,20, 5,21, 6,20, 6,18, 5,16, 4,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,14,  // (   ASCII 40
-	   11,25, 9,23, 7,20, 5,16, 4,11, 4, 7, 5, 2, 7,-2, 9,-5,11,-7,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,14,  // )   ASCII 41
-		3,25, 5,23, 7,20, 9,16,10,11,10, 7, 9, 2, 7,-2, 5,-5, 3,-7,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,16,  // *   ASCII 42
-		8,21, 8, 9,-1,-1, 3,18,13,12,-1,-1,13,18, 3,12,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,26,  // +   ASCII 43
-	   13,18,13, 0,-1,-1, 4, 9,22, 9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,10,  // ,   ASCII 44
-		6, 1, 5, 0, 4, 1, 5, 2, 6, 1, 6,-1, 5,-3, 4,-4,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2,26,  // -   ASCII 45
-		4, 9,22, 9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,10,  // .   ASCII 46
-		5, 2, 4, 1, 5, 0, 6, 1, 5, 2,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2,22,  // /   ASCII 47
-	   20,25, 2,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,20,  // 0   ASCII 48
-		9,21, 6,20, 4,17, 3,12, 3, 9, 4, 4, 6, 1, 9, 0,11, 0,14, 1,16, 4,17,
-		9,17,12,16,17,14,20,11,21, 9,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    4,20,  // 1   ASCII 49
-		6,17, 8,18,11,21,11, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   14,20,  // 2   ASCII 50
-		4,16, 4,17, 5,19, 6,20, 8,21,12,21,14,20,15,19,16,17,16,15,15,13,13,
-	   10, 3, 0,17, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   15,20,  // 3   ASCII 51
-		5,21,16,21,10,13,13,13,15,12,16,11,17, 8,17, 6,16, 3,14, 1,11, 0, 8,
-		0, 5, 1, 4, 2, 3, 4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    6,20,  // 4   ASCII 52
-	   13,21, 3, 7,18, 7,-1,-1,13,21,13, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,20,  // 5   ASCII 53
-	   15,21, 5,21, 4,12, 5,13, 8,14,11,14,14,13,16,11,17, 8,17, 6,16, 3,14,
-		1,11, 0, 8, 0, 5, 1, 4, 2, 3, 4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   23,20,  // 6   ASCII 54
-	   16,18,15,20,12,21,10,21, 7,20, 5,17, 4,12, 4, 7, 5, 3, 7, 1,10, 0,11,
-		0,14, 1,16, 3,17, 6,17, 7,16,10,14,12,11,13,10,13, 7,12, 5,10, 4, 7,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,20,  // 7   ASCII 55
-	   17,21, 7, 0,-1,-1, 3,21,17,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   29,20,  // 8   ASCII 56
-		8,21, 5,20, 4,18, 4,16, 5,14, 7,13,11,12,14,11,16, 9,17, 7,17, 4,16,
-		2,15, 1,12, 0, 8, 0, 5, 1, 4, 2, 3, 4, 3, 7, 4, 9, 6,11, 9,12,13,13,
-	   15,14,16,16,16,18,15,20,12,21, 8,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   23,20,  // 9   ASCII 57
-	   16,14,15,11,13, 9,10, 8, 9, 8, 6, 9, 4,11, 3,14, 3,15, 4,18, 6,20, 9,
-	   21,10,21,13,20,15,18,16,14,16, 9,15, 4,13, 1,10, 0, 8, 0, 5, 1, 4, 3,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,10,  // :   ASCII 58
-		5,14, 4,13, 5,12, 6,13, 5,14,-1,-1, 5, 2, 4, 1, 5, 0, 6, 1, 5, 2,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   14,10,  // ;   ASCII 59
-		5,14, 4,13, 5,12, 6,13, 5,14,-1,-1, 6, 1, 5, 0, 4, 1, 5, 2, 6, 1, 6,
-	   -1, 5,-3, 4,-4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    3,24,  // <   ASCII 60
-	   20,18, 4, 9,20, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,26,  // =   ASCII 61
-		4,12,22,12,-1,-1, 4, 6,22, 6,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    3,24,  // >   ASCII 62
-		4,18,20, 9, 4, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   20,18,  // ?   ASCII 63
-		3,16, 3,17, 4,19, 5,20, 7,21,11,21,13,20,14,19,15,17,15,15,14,13,13,
-	   12, 9,10, 9, 7,-1,-1, 9, 2, 8, 1, 9, 0,10, 1, 9, 2,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   54,27,  // @   ASCII 64
-	// x0,y0 x1,y1 x2,y2 x3,y3 x4,y4 x5,y5 x6,y6 x7,y7 x8,y8 x9,y9 xA,yA,xB,yB xC,yC xD,yD xE,yE xF,yF
-	   18,13,17,15,15,16,12,16,10,15, 9,14, 8,11, 8, 8, 9, 6,11, 5,14, 5,16, 6,17, 8,-1,-1,12,16,10,14,
- 	    9,11, 9, 8,10, 6,11, 5,-1,-1,18,16,17, 8,17, 6,19, 5,21, 5,23, 7,24,10,24,12,23,15,22,17,20,19,
-	   18,20,15,21,12,21, 9,20, 7,19, 5,17, 4,15, 3,12, 3, 9, 4, 6, 5, 4, 7, 2, 9, 1,12, 0,15, 0,18, 1,
-	   20, 2,21, 3,-1,-1,19,16,18, 8,18, 6,19, 5},
-	{    8,18,  // A   ASCII 65
-		9,21, 1, 0,-1,-1, 9,21,17, 0,-1,-1, 4, 7,14, 7,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   23,21,  // B   ASCII 66
-		4,21, 4, 0,-1,-1, 4,21,13,21,16,20,17,19,18,17,18,15,17,13,16,12,13,
-	   11,-1,-1, 4,11,13,11,16,10,17, 9,18, 7,18, 4,17, 2,16, 1,13, 0, 4, 0,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   18,21,  // C   ASCII 67
-	   18,16,17,18,15,20,13,21, 9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5,
-		3, 7, 1, 9, 0,13, 0,15, 1,17, 3,18, 5,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   15,21,  // D   ASCII 68
-		4,21, 4, 0,-1,-1, 4,21,11,21,14,20,16,18,17,16,18,13,18, 8,17, 5,16,
-		3,14, 1,11, 0, 4, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,19,  // E   ASCII 69
-		4,21, 4, 0,-1,-1, 4,21,17,21,-1,-1, 4,11,12,11,-1,-1, 4, 0,17, 0,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,18,  // F   ASCII 70
-		4,21, 4, 0,-1,-1, 4,21,17,21,-1,-1, 4,11,12,11,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   22,21,  // G   ASCII 71
-	   18,16,17,18,15,20,13,21, 9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5,
-		3, 7, 1, 9, 0,13, 0,15, 1,17, 3,18, 5,18, 8,-1,-1,13, 8,18, 8,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,22,  // H   ASCII 72
-		4,21, 4, 0,-1,-1,18,21,18, 0,-1,-1, 4,11,18,11,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2, 8,  // I   ASCII 73
-		4,21, 4, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,16,  // J   ASCII 74
-	   12,21,12, 5,11, 2,10, 1, 8, 0, 6, 0, 4, 1, 3, 2, 2, 5, 2, 7,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,21,  // K   ASCII 75
-		4,21, 4, 0,-1,-1,18,21, 4, 7,-1,-1, 9,12,18, 0,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,17,  // L   ASCII 76
-		4,21, 4, 0,-1,-1, 4, 0,16, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,24,  // M   ASCII 77
-		4,21, 4, 0,-1,-1, 4,21,12, 0,-1,-1,20,21,12, 0,-1,-1,20,21,20, 0,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,22,  // N   ASCII 78
-		4,21, 4, 0,-1,-1, 4,21,18, 0,-1,-1,18,21,18, 0,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   21,22,  // O   ASCII 79
-		9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5, 3, 7, 1, 9, 0,13, 0,15,
-		1,17, 3,18, 5,19, 8,19,13,18,16,17,18,15,20,13,21, 9,21,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   13,21,  // P   ASCII 80
-		4,21, 4, 0,-1,-1, 4,21,13,21,16,20,17,19,18,17,18,14,17,12,16,11,13,
-	   10, 4,10,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   24,22,  // Q   ASCII 81
-		9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5, 3, 7, 1, 9, 0,13, 0,15,
-		1,17, 3,18, 5,19, 8,19,13,18,16,17,18,15,20,13,21, 9,21,-1,-1,12, 4,
-	   18,-2,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   16,21,  // R   ASCII 82
-		4,21, 4, 0,-1,-1, 4,21,13,21,16,20,17,19,18,17,18,15,17,13,16,12,13,
-	   11, 4,11,-1,-1,11,11,18, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   20,20,  // S   ASCII 83
-	   17,18,15,20,12,21, 8,21, 5,20, 3,18, 3,16, 4,14, 5,13, 7,12,13,10,15,
-		9,16, 8,17, 6,17, 3,15, 1,12, 0, 8, 0, 5, 1, 3, 3,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,16,  // T   ASCII 84
-		8,21, 8, 0,-1,-1, 1,21,15,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,22,  // U   ASCII 85
-		4,21, 4, 6, 5, 3, 7, 1,10, 0,12, 0,15, 1,17, 3,18, 6,18,21,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,18,  // V   ASCII 86
-		1,21, 9, 0,-1,-1,17,21, 9, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,24,  // W   ASCII 87
-		2,21, 7, 0,-1,-1,12,21, 7, 0,-1,-1,12,21,17, 0,-1,-1,22,21,17, 0,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,20,  // X   ASCII 88
-		3,21,17, 0,-1,-1,17,21, 3, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    6,18,  // Y   ASCII 89
-		1,21, 9,11, 9, 0,-1,-1,17,21, 9,11,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,20,  // Z   ASCII 90
-	   17,21, 3, 0,-1,-1, 3,21,17,21,-1,-1, 3, 0,17, 0,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,14,  // [   ASCII 91
-		4,25, 4,-7,-1,-1, 5,25, 5,-7,-1,-1, 4,25,11,25,-1,-1, 4,-7,11,-7,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2,14,  // \   ASCII 92
-		0,21,14,-3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,14,  // ]   ASCII 93
-		9,25, 9,-7,-1,-1,10,25,10,-7,-1,-1, 3,25,10,25,-1,-1, 3,-7,10,-7,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,16,  // ^   ASCII 94
-		6,15, 8,18,10,15,-1,-1, 3,12, 8,17,13,12,-1,-1, 8,17, 8, 0,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2,16,  // _   ASCII 95
-		0,-2,16,-2,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    7,10,  // `   ASCII 96
-		6,21, 5,20, 4,18, 4,16, 5,15, 6,16, 5,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,19,  // a   ASCII 97
-	   15,14,15, 0,-1,-1,15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-		3, 6, 1, 8, 0,11, 0,13, 1,15, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,19,  // b   ASCII 98
-		4,21, 4, 0,-1,-1, 4,11, 6,13, 8,14,11,14,13,13,15,11,16, 8,16, 6,15,
-		3,13, 1,11, 0, 8, 0, 6, 1, 4, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   14,18,  // c   ASCII 99
-	   15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4, 3, 6, 1, 8, 0,11,
-		0,13, 1,15, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,19,  // d   ASCII 100
-	   15,21,15, 0,-1,-1,15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-		3, 6, 1, 8, 0,11, 0,13, 1,15, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,18,  // e   ASCII 101
-		3, 8,15, 8,15,10,14,12,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-		3, 6, 1, 8, 0,11, 0,13, 1,15, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,12,  // f   ASCII 102
-	   10,21, 8,21, 6,20, 5,17, 5, 0,-1,-1, 2,14, 9,14,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   22,19,  // g   ASCII 103
-	   15,14,15,-2,14,-5,13,-6,11,-7, 8,-7, 6,-6,-1,-1,15,11,13,13,11,14, 8,
-	   14, 6,13, 4,11, 3, 8, 3, 6, 4, 3, 6, 1, 8, 0,11, 0,13, 1,15, 3,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,19,  // h   ASCII 104
-		4,21, 4, 0,-1,-1, 4,10, 7,13, 9,14,12,14,14,13,15,10,15, 0,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8, 8,  // i   ASCII 105
-		3,21, 4,20, 5,21, 4,22, 3,21,-1,-1, 4,14, 4, 0,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,10,  // j   ASCII 106
-		5,21, 6,20, 7,21, 6,22, 5,21,-1,-1, 6,14, 6,-3, 5,-6, 3,-7, 1,-7,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,17,  // k   ASCII 107
-		4,21, 4, 0,-1,-1,14,14, 4, 4,-1,-1, 8, 8,15, 0,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2, 8,  // l   ASCII 108
-		4,21, 4, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   18,30,  // m   ASCII 109
-		4,14, 4, 0,-1,-1, 4,10, 7,13, 9,14,12,14,14,13,15,10,15, 0,-1,-1,15,
-	   10,18,13,20,14,23,14,25,13,26,10,26, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,19,  // n   ASCII 110
-		4,14, 4, 0,-1,-1, 4,10, 7,13, 9,14,12,14,14,13,15,10,15, 0,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,19,  // o   ASCII 111
-		8,14, 6,13, 4,11, 3, 8, 3, 6, 4, 3, 6, 1, 8, 0,11, 0,13, 1,15, 3,16,
-		6,16, 8,15,11,13,13,11,14, 8,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,19,  // p   ASCII 112
-		4,14, 4,-7,-1,-1, 4,11, 6,13, 8,14,11,14,13,13,15,11,16, 8,16, 6,15,
-		3,13, 1,11, 0, 8, 0, 6, 1, 4, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,19,  // q   ASCII 113
-	   15,14,15,-7,-1,-1,15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-		3, 6, 1, 8, 0,11, 0,13, 1,15, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,13,  // r   ASCII 114
-		4,14, 4, 0,-1,-1, 4, 8, 5,11, 7,13, 9,14,12,14,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   17,17,  // s   ASCII 115
-	   14,11,13,13,10,14, 7,14, 4,13, 3,11, 4, 9, 6, 8,11, 7,13, 6,14, 4,14,
-		3,13, 1,10, 0, 7, 0, 4, 1, 3, 3,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,12,  // t   ASCII 116
-		5,21, 5, 4, 6, 1, 8, 0,10, 0,-1,-1, 2,14, 9,14,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   10,19,  // u   ASCII 117
-		4,14, 4, 4, 5, 1, 7, 0,10, 0,12, 1,15, 4,-1,-1,15,14,15, 0,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,16,  // v   ASCII 118
-		2,14, 8, 0,-1,-1,14,14, 8, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   11,22,  // w   ASCII 119
-		3,14, 7, 0,-1,-1,11,14, 7, 0,-1,-1,11,14,15, 0,-1,-1,19,14,15, 0,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    5,17,  // x   ASCII 120
-		3,14,14, 0,-1,-1,14,14, 3, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    9,16,  // y   ASCII 121
-		2,14, 8, 0,-1,-1,14,14, 8, 0, 6,-4, 4,-6, 2,-7, 1,-7,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    8,17,  // z   ASCII 122
-	   14,14, 3, 0,-1,-1, 3,14,14,14,-1,-1, 3, 0,14, 0,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   39,14,  // {   ASCII 123
-		9,25, 7,24, 6,23, 5,21, 5,19, 6,17, 7,16, 8,14, 8,12, 6,10,-1,-1, 7,
-	   24, 6,22, 6,20, 7,18, 8,17, 9,15, 9,13, 8,11, 4, 9, 8, 7, 9, 5, 9, 3,
-		8, 1, 7, 0, 6,-2, 6,-4, 7,-6,-1,-1, 6, 8, 8, 6, 8, 4, 7, 2, 6, 1, 5,
-	   -1, 5,-3, 6,-5, 7,-6, 9,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{    2, 8,  // |   ASCII 124
-		4,25, 4,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   39,14,  // }   ASCII 125
-		5,25, 7,24, 8,23, 9,21, 9,19, 8,17, 7,16, 6,14, 6,12, 8,10,-1,-1, 7,
-	   24, 8,22, 8,20, 7,18, 6,17, 5,15, 5,13, 6,11,10, 9, 6, 7, 5, 5, 5, 3,
-		6, 1, 7, 0, 8,-2, 8,-4, 7,-6,-1,-1, 8, 8, 6, 6, 6, 4, 7, 2, 8, 1, 9,
-	   -1, 9,-3, 8,-5, 7,-6, 5,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-	{   23,24,  // ~   ASCII 126
-		3, 6, 3, 8, 4,11, 6,12, 8,12,10,11,14, 8,16, 7,18, 7,20, 8,21,10,-1,
-	   -1, 3, 8, 4,10, 6,11, 8,11,10,10,14, 7,16, 6,18, 6,20, 7,21,10,21,12,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
+	static const int8_t HersheycharHt = 38;		//was 25...
+	static const int8_t HersheyPenUp = -128;	//Pen-up marker within HersheyVertexStream[]
+	static const int8_t HersheyBaselineOffset = HersheycharHt / 3;	//The Hershey ROM is biased up by about 1/2 a character cell...
+
+	struct HersheyGlyph {
+		uint16_t Offset;	//Index of first byte of this character in HersheyVertexStream[]
+		uint8_t Length;		//Number of bytes (x,y coordinates and HersheyPenUp markers)
+		int8_t Width;		//Character width (from the original Hershey data)
+		int8_t CellLeft;	//Smallest X-coordinate of the character (never more than 0)
+		int8_t CellRight;	//Largest X-coordinate of the character (never less than 0)
+		uint8_t Advance;	//Proportional spacing cell width: CellRight-CellLeft+4, minimum 8
+	};
+
+	static const int8_t HersheyVertexStream[2294] PROGMEM = {
+	// [space]   ASCII 32
+	// !   ASCII 33
+	  5, 21,  5,  7, HersheyPenUp,  5,  2,  4,  1,  5,  0,  6,  1,  5,  2,
+	// "   ASCII 34
+	  4, 21,  4, 14, HersheyPenUp, 12, 21, 12, 14,
+	// #   ASCII 35
+	 11, 25,  4, -7, HersheyPenUp, 17, 25, 10, -7, HersheyPenUp,  4, 12, 18, 12, HersheyPenUp,  3,  6, 17,  6,
+	// $   ASCII 36
+	  8, 25,  8, -4, HersheyPenUp, 12, 25, 12, -4, HersheyPenUp, 17, 18, 15, 20, 12, 21,  8, 21,  5, 20,  3, 18,  3,
+	 16,  4, 14,  5, 13,  7, 12, 13, 10, 15,  9, 16,  8, 17,  6, 17,  3, 15,  1, 12,  0,  8,  0,  5,  1,  3,  3,
+	// %   ASCII 37
+	 21, 21,  3,  0, HersheyPenUp,  8, 21, 10, 19, 10, 17,  9, 15,  7, 14,  5, 14,  3, 16,  3, 18,  4, 20,  6, 21,
+	  8, 21, 10, 20, 13, 19, 16, 19, 19, 20, 21, 21, HersheyPenUp, 17,  7, 15,  6, 14,  4, 14,  2, 16,  0, 18,  0,
+	 20,  1, 21,  3, 21,  5, 19,  7, 17,  7,
+	// &   ASCII 38
+	 23, 12, 23, 13, 22, 14, 21, 14, 20, 13, 19, 11, 17,  6, 15,  3, 13,  1, 11,  0,  7,  0,  5,  1,  4,  2,  3,  4,
+	  3,  6,  4,  8,  5,  9, 12, 13, 13, 14, 14, 16, 14, 18, 13, 20, 11, 21,  9, 20,  8, 18,  8, 16,  9, 13, 11, 10,
+	 16,  3, 18,  1, 20,  0, 22,  0, 23,  1, 23,  2,
+	// '   ASCII 39
+	  5, 19,  4, 20,  5, 21,  6, 20,  6, 18,  5, 16,  4, 15,
+	// (   ASCII 40
+	 11, 25,  9, 23,  7, 20,  5, 16,  4, 11,  4,  7,  5,  2,  7, -2,  9, -5, 11, -7,
+	// )   ASCII 41
+	  3, 25,  5, 23,  7, 20,  9, 16, 10, 11, 10,  7,  9,  2,  7, -2,  5, -5,  3, -7,
+	// *   ASCII 42
+	  8, 21,  8,  9, HersheyPenUp,  3, 18, 13, 12, HersheyPenUp, 13, 18,  3, 12,
+	// +   ASCII 43
+	 13, 18, 13,  0, HersheyPenUp,  4,  9, 22,  9,
+	// ,   ASCII 44
+	  6,  1,  5,  0,  4,  1,  5,  2,  6,  1,  6, -1,  5, -3,  4, -4,
+	// -   ASCII 45
+	  4,  9, 22,  9,
+	// .   ASCII 46
+	  5,  2,  4,  1,  5,  0,  6,  1,  5,  2,
+	// /   ASCII 47
+	 20, 25,  2, -7,
+	// 0   ASCII 48
+	  9, 21,  6, 20,  4, 17,  3, 12,  3,  9,  4,  4,  6,  1,  9,  0, 11,  0, 14,  1, 16,  4, 17,  9, 17, 12, 16, 17,
+	 14, 20, 11, 21,  9, 21,
+	// 1   ASCII 49
+	  6, 17,  8, 18, 11, 21, 11,  0,
+	// 2   ASCII 50
+	  4, 16,  4, 17,  5, 19,  6, 20,  8, 21, 12, 21, 14, 20, 15, 19, 16, 17, 16, 15, 15, 13, 13, 10,  3,  0, 17,  0,
+	// 3   ASCII 51
+	  5, 21, 16, 21, 10, 13, 13, 13, 15, 12, 16, 11, 17,  8, 17,  6, 16,  3, 14,  1, 11,  0,  8,  0,  5,  1,  4,  2,
+	  3,  4,
+	// 4   ASCII 52
+	 13, 21,  3,  7, 18,  7, HersheyPenUp, 13, 21, 13,  0,
+	// 5   ASCII 53
+	 15, 21,  5, 21,  4, 12,  5, 13,  8, 14, 11, 14, 14, 13, 16, 11, 17,  8, 17,  6, 16,  3, 14,  1, 11,  0,  8,  0,
+	  5,  1,  4,  2,  3,  4,
+	// 6   ASCII 54
+	 16, 18, 15, 20, 12, 21, 10, 21,  7, 20,  5, 17,  4, 12,  4,  7,  5,  3,  7,  1, 10,  0, 11,  0, 14,  1, 16,  3,
+	 17,  6, 17,  7, 16, 10, 14, 12, 11, 13, 10, 13,  7, 12,  5, 10,  4,  7,
+	// 7   ASCII 55
+	 17, 21,  7,  0, HersheyPenUp,  3, 21, 17, 21,
+	// 8   ASCII 56
+	  8, 21,  5, 20,  4, 18,  4, 16,  5, 14,  7, 13, 11, 12, 14, 11, 16,  9, 17,  7, 17,  4, 16,  2, 15,  1, 12,  0,
+	  8,  0,  5,  1,  4,  2,  3,  4,  3,  7,  4,  9,  6, 11,  9, 12, 13, 13, 15, 14, 16, 16, 16, 18, 15, 20, 12, 21,
+	  8, 21,
+	// 9   ASCII 57
+	 16, 14, 15, 11, 13,  9, 10,  8,  9,  8,  6,  9,  4, 11,  3, 14,  3, 15,  4, 18,  6, 20,  9, 21, 10, 21, 13, 20,
+	 15, 18, 16, 14, 16,  9, 15,  4, 13,  1, 10,  0,  8,  0,  5,  1,  4,  3,
+	// :   ASCII 58
+	  5, 14,  4, 13,  5, 12,  6, 13,  5, 14, HersheyPenUp,  5,  2,  4,  1,  5,  0,  6,  1,  5,  2,
+	// ;   ASCII 59
+	  5, 14,  4, 13,  5, 12,  6, 13,  5, 14, HersheyPenUp,  6,  1,  5,  0,  4,  1,  5,  2,  6,  1,  6, -1,  5, -3,
+	  4, -4,
+	// <   ASCII 60
+	 20, 18,  4,  9, 20,  0,
+	// =   ASCII 61
+	  4, 12, 22, 12, HersheyPenUp,  4,  6, 22,  6,
+	// >   ASCII 62
+	  4, 18, 20,  9,  4,  0,
+	// ?   ASCII 63
+	  3, 16,  3, 17,  4, 19,  5, 20,  7, 21, 11, 21, 13, 20, 14, 19, 15, 17, 15, 15, 14, 13, 13, 12,  9, 10,  9,  7,
+	 HersheyPenUp,  9,  2,  8,  1,  9,  0, 10,  1,  9,  2,
+	// @   ASCII 64
+	 18, 13, 17, 15, 15, 16, 12, 16, 10, 15,  9, 14,  8, 11,  8,  8,  9,  6, 11,  5, 14,  5, 16,  6, 17,  8, HersheyPenUp,
+	 12, 16, 10, 14,  9, 11,  9,  8, 10,  6, 11,  5, HersheyPenUp, 18, 16, 17,  8, 17,  6, 19,  5, 21,  5, 23,  7,
+	 24, 10, 24, 12, 23, 15, 22, 17, 20, 19, 18, 20, 15, 21, 12, 21,  9, 20,  7, 19,  5, 17,  4, 15,  3, 12,  3,  9,
+	  4,  6,  5,  4,  7,  2,  9,  1, 12,  0, 15,  0, 18,  1, 20,  2, 21,  3, HersheyPenUp, 19, 16, 18,  8, 18,  6,
+	 19,  5,
+	// A   ASCII 65
+	  9, 21,  1,  0, HersheyPenUp,  9, 21, 17,  0, HersheyPenUp,  4,  7, 14,  7,
+	// B   ASCII 66
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 13, 21, 16, 20, 17, 19, 18, 17, 18, 15, 17, 13, 16, 12, 13, 11, HersheyPenUp,
+	  4, 11, 13, 11, 16, 10, 17,  9, 18,  7, 18,  4, 17,  2, 16,  1, 13,  0,  4,  0,
+	// C   ASCII 67
+	 18, 16, 17, 18, 15, 20, 13, 21,  9, 21,  7, 20,  5, 18,  4, 16,  3, 13,  3,  8,  4,  5,  5,  3,  7,  1,  9,  0,
+	 13,  0, 15,  1, 17,  3, 18,  5,
+	// D   ASCII 68
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 11, 21, 14, 20, 16, 18, 17, 16, 18, 13, 18,  8, 17,  5, 16,  3, 14,  1,
+	 11,  0,  4,  0,
+	// E   ASCII 69
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 17, 21, HersheyPenUp,  4, 11, 12, 11, HersheyPenUp,  4,  0, 17,  0,
+	// F   ASCII 70
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 17, 21, HersheyPenUp,  4, 11, 12, 11,
+	// G   ASCII 71
+	 18, 16, 17, 18, 15, 20, 13, 21,  9, 21,  7, 20,  5, 18,  4, 16,  3, 13,  3,  8,  4,  5,  5,  3,  7,  1,  9,  0,
+	 13,  0, 15,  1, 17,  3, 18,  5, 18,  8, HersheyPenUp, 13,  8, 18,  8,
+	// H   ASCII 72
+	  4, 21,  4,  0, HersheyPenUp, 18, 21, 18,  0, HersheyPenUp,  4, 11, 18, 11,
+	// I   ASCII 73
+	  4, 21,  4,  0,
+	// J   ASCII 74
+	 12, 21, 12,  5, 11,  2, 10,  1,  8,  0,  6,  0,  4,  1,  3,  2,  2,  5,  2,  7,
+	// K   ASCII 75
+	  4, 21,  4,  0, HersheyPenUp, 18, 21,  4,  7, HersheyPenUp,  9, 12, 18,  0,
+	// L   ASCII 76
+	  4, 21,  4,  0, HersheyPenUp,  4,  0, 16,  0,
+	// M   ASCII 77
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 12,  0, HersheyPenUp, 20, 21, 12,  0, HersheyPenUp, 20, 21, 20,  0,
+	// N   ASCII 78
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 18,  0, HersheyPenUp, 18, 21, 18,  0,
+	// O   ASCII 79
+	  9, 21,  7, 20,  5, 18,  4, 16,  3, 13,  3,  8,  4,  5,  5,  3,  7,  1,  9,  0, 13,  0, 15,  1, 17,  3, 18,  5,
+	 19,  8, 19, 13, 18, 16, 17, 18, 15, 20, 13, 21,  9, 21,
+	// P   ASCII 80
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 13, 21, 16, 20, 17, 19, 18, 17, 18, 14, 17, 12, 16, 11, 13, 10,  4, 10,
+	// Q   ASCII 81
+	  9, 21,  7, 20,  5, 18,  4, 16,  3, 13,  3,  8,  4,  5,  5,  3,  7,  1,  9,  0, 13,  0, 15,  1, 17,  3, 18,  5,
+	 19,  8, 19, 13, 18, 16, 17, 18, 15, 20, 13, 21,  9, 21, HersheyPenUp, 12,  4, 18, -2,
+	// R   ASCII 82
+	  4, 21,  4,  0, HersheyPenUp,  4, 21, 13, 21, 16, 20, 17, 19, 18, 17, 18, 15, 17, 13, 16, 12, 13, 11,  4, 11,
+	 HersheyPenUp, 11, 11, 18,  0,
+	// S   ASCII 83
+	 17, 18, 15, 20, 12, 21,  8, 21,  5, 20,  3, 18,  3, 16,  4, 14,  5, 13,  7, 12, 13, 10, 15,  9, 16,  8, 17,  6,
+	 17,  3, 15,  1, 12,  0,  8,  0,  5,  1,  3,  3,
+	// T   ASCII 84
+	  8, 21,  8,  0, HersheyPenUp,  1, 21, 15, 21,
+	// U   ASCII 85
+	  4, 21,  4,  6,  5,  3,  7,  1, 10,  0, 12,  0, 15,  1, 17,  3, 18,  6, 18, 21,
+	// V   ASCII 86
+	  1, 21,  9,  0, HersheyPenUp, 17, 21,  9,  0,
+	// W   ASCII 87
+	  2, 21,  7,  0, HersheyPenUp, 12, 21,  7,  0, HersheyPenUp, 12, 21, 17,  0, HersheyPenUp, 22, 21, 17,  0,
+	// X   ASCII 88
+	  3, 21, 17,  0, HersheyPenUp, 17, 21,  3,  0,
+	// Y   ASCII 89
+	  1, 21,  9, 11,  9,  0, HersheyPenUp, 17, 21,  9, 11,
+	// Z   ASCII 90
+	 17, 21,  3,  0, HersheyPenUp,  3, 21, 17, 21, HersheyPenUp,  3,  0, 17,  0,
+	// [   ASCII 91
+	  4, 25,  4, -7, HersheyPenUp,  5, 25,  5, -7, HersheyPenUp,  4, 25, 11, 25, HersheyPenUp,  4, -7, 11, -7,
+	// \   ASCII 92
+	  0, 21, 14, -3,
+	// ]   ASCII 93
+	  9, 25,  9, -7, HersheyPenUp, 10, 25, 10, -7, HersheyPenUp,  3, 25, 10, 25, HersheyPenUp,  3, -7, 10, -7,
+	// ^   ASCII 94
+	  6, 15,  8, 18, 10, 15, HersheyPenUp,  3, 12,  8, 17, 13, 12, HersheyPenUp,  8, 17,  8,  0,
+	// _   ASCII 95
+	  0, -2, 16, -2,
+	// `   ASCII 96
+	  6, 21,  5, 20,  4, 18,  4, 16,  5, 15,  6, 16,  5, 17,
+	// a   ASCII 97
+	 15, 14, 15,  0, HersheyPenUp, 15, 11, 13, 13, 11, 14,  8, 14,  6, 13,  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,
+	  8,  0, 11,  0, 13,  1, 15,  3,
+	// b   ASCII 98
+	  4, 21,  4,  0, HersheyPenUp,  4, 11,  6, 13,  8, 14, 11, 14, 13, 13, 15, 11, 16,  8, 16,  6, 15,  3, 13,  1,
+	 11,  0,  8,  0,  6,  1,  4,  3,
+	// c   ASCII 99
+	 15, 11, 13, 13, 11, 14,  8, 14,  6, 13,  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,  8,  0, 11,  0, 13,  1, 15,  3,
+	// d   ASCII 100
+	 15, 21, 15,  0, HersheyPenUp, 15, 11, 13, 13, 11, 14,  8, 14,  6, 13,  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,
+	  8,  0, 11,  0, 13,  1, 15,  3,
+	// e   ASCII 101
+	  3,  8, 15,  8, 15, 10, 14, 12, 13, 13, 11, 14,  8, 14,  6, 13,  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,  8,  0,
+	 11,  0, 13,  1, 15,  3,
+	// f   ASCII 102
+	 10, 21,  8, 21,  6, 20,  5, 17,  5,  0, HersheyPenUp,  2, 14,  9, 14,
+	// g   ASCII 103
+	 15, 14, 15, -2, 14, -5, 13, -6, 11, -7,  8, -7,  6, -6, HersheyPenUp, 15, 11, 13, 13, 11, 14,  8, 14,  6, 13,
+	  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,  8,  0, 11,  0, 13,  1, 15,  3,
+	// h   ASCII 104
+	  4, 21,  4,  0, HersheyPenUp,  4, 10,  7, 13,  9, 14, 12, 14, 14, 13, 15, 10, 15,  0,
+	// i   ASCII 105
+	  3, 21,  4, 20,  5, 21,  4, 22,  3, 21, HersheyPenUp,  4, 14,  4,  0,
+	// j   ASCII 106
+	  5, 21,  6, 20,  7, 21,  6, 22,  5, 21, HersheyPenUp,  6, 14,  6, -3,  5, -6,  3, -7,  1, -7,
+	// k   ASCII 107
+	  4, 21,  4,  0, HersheyPenUp, 14, 14,  4,  4, HersheyPenUp,  8,  8, 15,  0,
+	// l   ASCII 108
+	  4, 21,  4,  0,
+	// m   ASCII 109
+	  4, 14,  4,  0, HersheyPenUp,  4, 10,  7, 13,  9, 14, 12, 14, 14, 13, 15, 10, 15,  0, HersheyPenUp, 15, 10, 18,
+	 13, 20, 14, 23, 14, 25, 13, 26, 10, 26,  0,
+	// n   ASCII 110
+	  4, 14,  4,  0, HersheyPenUp,  4, 10,  7, 13,  9, 14, 12, 14, 14, 13, 15, 10, 15,  0,
+	// o   ASCII 111
+	  8, 14,  6, 13,  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,  8,  0, 11,  0, 13,  1, 15,  3, 16,  6, 16,  8, 15, 11,
+	 13, 13, 11, 14,  8, 14,
+	// p   ASCII 112
+	  4, 14,  4, -7, HersheyPenUp,  4, 11,  6, 13,  8, 14, 11, 14, 13, 13, 15, 11, 16,  8, 16,  6, 15,  3, 13,  1,
+	 11,  0,  8,  0,  6,  1,  4,  3,
+	// q   ASCII 113
+	 15, 14, 15, -7, HersheyPenUp, 15, 11, 13, 13, 11, 14,  8, 14,  6, 13,  4, 11,  3,  8,  3,  6,  4,  3,  6,  1,
+	  8,  0, 11,  0, 13,  1, 15,  3,
+	// r   ASCII 114
+	  4, 14,  4,  0, HersheyPenUp,  4,  8,  5, 11,  7, 13,  9, 14, 12, 14,
+	// s   ASCII 115
+	 14, 11, 13, 13, 10, 14,  7, 14,  4, 13,  3, 11,  4,  9,  6,  8, 11,  7, 13,  6, 14,  4, 14,  3, 13,  1, 10,  0,
+	  7,  0,  4,  1,  3,  3,
+	// t   ASCII 116
+	  5, 21,  5,  4,  6,  1,  8,  0, 10,  0, HersheyPenUp,  2, 14,  9, 14,
+	// u   ASCII 117
+	  4, 14,  4,  4,  5,  1,  7,  0, 10,  0, 12,  1, 15,  4, HersheyPenUp, 15, 14, 15,  0,
+	// v   ASCII 118
+	  2, 14,  8,  0, HersheyPenUp, 14, 14,  8,  0,
+	// w   ASCII 119
+	  3, 14,  7,  0, HersheyPenUp, 11, 14,  7,  0, HersheyPenUp, 11, 14, 15,  0, HersheyPenUp, 19, 14, 15,  0,
+	// x   ASCII 120
+	  3, 14, 14,  0, HersheyPenUp, 14, 14,  3,  0,
+	// y   ASCII 121
+	  2, 14,  8,  0, HersheyPenUp, 14, 14,  8,  0,  6, -4,  4, -6,  2, -7,  1, -7,
+	// z   ASCII 122
+	 14, 14,  3,  0, HersheyPenUp,  3, 14, 14, 14, HersheyPenUp,  3,  0, 14,  0,
+	// {   ASCII 123
+	  9, 25,  7, 24,  6, 23,  5, 21,  5, 19,  6, 17,  7, 16,  8, 14,  8, 12,  6, 10, HersheyPenUp,  7, 24,  6, 22,
+	  6, 20,  7, 18,  8, 17,  9, 15,  9, 13,  8, 11,  4,  9,  8,  7,  9,  5,  9,  3,  8,  1,  7,  0,  6, -2,  6, -4,
+	  7, -6, HersheyPenUp,  6,  8,  8,  6,  8,  4,  7,  2,  6,  1,  5, -1,  5, -3,  6, -5,  7, -6,  9, -7,
+	// |   ASCII 124
+	  4, 25,  4, -7,
+	// }   ASCII 125
+	  5, 25,  7, 24,  8, 23,  9, 21,  9, 19,  8, 17,  7, 16,  6, 14,  6, 12,  8, 10, HersheyPenUp,  7, 24,  8, 22,
+	  8, 20,  7, 18,  6, 17,  5, 15,  5, 13,  6, 11, 10,  9,  6,  7,  5,  5,  5,  3,  6,  1,  7,  0,  8, -2,  8, -4,
+	  7, -6, HersheyPenUp,  8,  8,  6,  6,  6,  4,  7,  2,  8,  1,  9, -1,  9, -3,  8, -5,  7, -6,  5, -7,
+	// ~   ASCII 126
+	  3,  6,  3,  8,  4, 11,  6, 12,  8, 12, 10, 11, 14,  8, 16,  7, 18,  7, 20,  8, 21, 10, HersheyPenUp,  3,  8,
+	  4, 10,  6, 11,  8, 11, 10, 10, 14,  7, 16,  6, 18,  6, 20,  7, 21, 10, 21, 12
+	};
+
+	static const HersheyGlyph HersheyGlyphIndex[95] PROGMEM = {
+		{    0,   0, 16,   0,   0,  8},	// [space]   ASCII 32
+		{    0,  15, 10,   0,   6, 10},	// !   ASCII 33
+		{   15,   9, 16,   0,  12, 16},	// "   ASCII 34
+		{   24,  19, 21,   0,  18, 22},	// #   ASCII 35
+		{   43,  50, 20,   0,  17, 21},	// $   ASCII 36
+		{   93,  60, 24,   0,  21, 25},	// %   ASCII 37
+		{  153,  68, 26,   0,  23, 27},	// &   ASCII 38
+		{  221,  14, 10,   0,   6, 10},	// '   ASCII 39
+		{  235,  20, 14,   0,  11, 15},	// (   ASCII 40
+		{  255,  20, 14,   0,  10, 14},	// )   ASCII 41
+		{  275,  14, 16,   0,  13, 17},	// *   ASCII 42
+		{  289,   9, 26,   0,  22, 26},	// +   ASCII 43
+		{  298,  16, 10,   0,   6, 10},	// ,   ASCII 44
+		{  314,   4, 26,   0,  22, 26},	// -   ASCII 45
+		{  318,  10, 10,   0,   6, 10},	// .   ASCII 46
+		{  328,   4, 22,   0,  20, 24},	// /   ASCII 47
+		{  332,  34, 20,   0,  17, 21},	// 0   ASCII 48
+		{  366,   8, 20,   0,  11, 15},	// 1   ASCII 49
+		{  374,  28, 20,   0,  17, 21},	// 2   ASCII 50
+		{  402,  30, 20,   0,  17, 21},	// 3   ASCII 51
+		{  432,  11, 20,   0,  18, 22},	// 4   ASCII 52
+		{  443,  34, 20,   0,  17, 21},	// 5   ASCII 53
+		{  477,  46, 20,   0,  17, 21},	// 6   ASCII 54
+		{  523,   9, 20,   0,  17, 21},	// 7   ASCII 55
+		{  532,  58, 20,   0,  17, 21},	// 8   ASCII 56
+		{  590,  46, 20,   0,  16, 20},	// 9   ASCII 57
+		{  636,  21, 10,   0,   6, 10},	// :   ASCII 58
+		{  657,  27, 10,   0,   6, 10},	// ;   ASCII 59
+		{  684,   6, 24,   0,  20, 24},	// <   ASCII 60
+		{  690,   9, 26,   0,  22, 26},	// =   ASCII 61
+		{  699,   6, 24,   0,  20, 24},	// >   ASCII 62
+		{  705,  39, 18,   0,  15, 19},	// ?   ASCII 63
+		{  744, 107, 27,   0,  24, 28},	// @   ASCII 64
+		{  851,  14, 18,   0,  17, 21},	// A   ASCII 65
+		{  865,  44, 21,   0,  18, 22},	// B   ASCII 66
+		{  909,  36, 21,   0,  18, 22},	// C   ASCII 67
+		{  945,  29, 21,   0,  18, 22},	// D   ASCII 68
+		{  974,  19, 19,   0,  17, 21},	// E   ASCII 69
+		{  993,  14, 18,   0,  17, 21},	// F   ASCII 70
+		{ 1007,  43, 21,   0,  18, 22},	// G   ASCII 71
+		{ 1050,  14, 22,   0,  18, 22},	// H   ASCII 72
+		{ 1064,   4,  8,   0,   4,  8},	// I   ASCII 73
+		{ 1068,  20, 16,   0,  12, 16},	// J   ASCII 74
+		{ 1088,  14, 21,   0,  18, 22},	// K   ASCII 75
+		{ 1102,   9, 17,   0,  16, 20},	// L   ASCII 76
+		{ 1111,  19, 24,   0,  20, 24},	// M   ASCII 77
+		{ 1130,  14, 22,   0,  18, 22},	// N   ASCII 78
+		{ 1144,  42, 22,   0,  19, 23},	// O   ASCII 79
+		{ 1186,  25, 21,   0,  18, 22},	// P   ASCII 80
+		{ 1211,  47, 22,   0,  19, 23},	// Q   ASCII 81
+		{ 1258,  30, 21,   0,  18, 22},	// R   ASCII 82
+		{ 1288,  40, 20,   0,  17, 21},	// S   ASCII 83
+		{ 1328,   9, 16,   0,  15, 19},	// T   ASCII 84
+		{ 1337,  20, 22,   0,  18, 22},	// U   ASCII 85
+		{ 1357,   9, 18,   0,  17, 21},	// V   ASCII 86
+		{ 1366,  19, 24,   0,  22, 26},	// W   ASCII 87
+		{ 1385,   9, 20,   0,  17, 21},	// X   ASCII 88
+		{ 1394,  11, 18,   0,  17, 21},	// Y   ASCII 89
+		{ 1405,  14, 20,   0,  17, 21},	// Z   ASCII 90
+		{ 1419,  19, 14,   0,  11, 15},	// [   ASCII 91
+		{ 1438,   4, 14,   0,  14, 18},	// \   ASCII 92
+		{ 1442,  19, 14,   0,  10, 14},	// ]   ASCII 93
+		{ 1461,  18, 16,   0,  13, 17},	// ^   ASCII 94
+		{ 1479,   4, 16,   0,  16, 20},	// _   ASCII 95
+		{ 1483,  14, 10,   0,   6, 10},	// `   ASCII 96
+		{ 1497,  33, 19,   0,  15, 19},	// a   ASCII 97
+		{ 1530,  33, 19,   0,  16, 20},	// b   ASCII 98
+		{ 1563,  28, 18,   0,  15, 19},	// c   ASCII 99
+		{ 1591,  33, 19,   0,  15, 19},	// d   ASCII 100
+		{ 1624,  34, 18,   0,  15, 19},	// e   ASCII 101
+		{ 1658,  15, 12,   0,  10, 14},	// f   ASCII 102
+		{ 1673,  43, 19,   0,  15, 19},	// g   ASCII 103
+		{ 1716,  19, 19,   0,  15, 19},	// h   ASCII 104
+		{ 1735,  15,  8,   0,   5,  9},	// i   ASCII 105
+		{ 1750,  21, 10,   0,   7, 11},	// j   ASCII 106
+		{ 1771,  14, 17,   0,  15, 19},	// k   ASCII 107
+		{ 1785,   4,  8,   0,   4,  8},	// l   ASCII 108
+		{ 1789,  34, 30,   0,  26, 30},	// m   ASCII 109
+		{ 1823,  19, 19,   0,  15, 19},	// n   ASCII 110
+		{ 1842,  34, 19,   0,  16, 20},	// o   ASCII 111
+		{ 1876,  33, 19,   0,  16, 20},	// p   ASCII 112
+		{ 1909,  33, 19,   0,  15, 19},	// q   ASCII 113
+		{ 1942,  15, 13,   0,  12, 16},	// r   ASCII 114
+		{ 1957,  34, 17,   0,  14, 18},	// s   ASCII 115
+		{ 1991,  15, 12,   0,  10, 14},	// t   ASCII 116
+		{ 2006,  19, 19,   0,  15, 19},	// u   ASCII 117
+		{ 2025,   9, 16,   0,  14, 18},	// v   ASCII 118
+		{ 2034,  19, 22,   0,  19, 23},	// w   ASCII 119
+		{ 2053,   9, 17,   0,  14, 18},	// x   ASCII 120
+		{ 2062,  17, 16,   0,  14, 18},	// y   ASCII 121
+		{ 2079,  14, 17,   0,  14, 18},	// z   ASCII 122
+		{ 2093,  76, 14,   0,   9, 13},	// {   ASCII 123
+		{ 2169,   4,  8,   0,   4,  8},	// |   ASCII 124
+		{ 2173,  76, 14,   0,  10, 14},	// }   ASCII 125
+		{ 2249,  45, 24,   0,  21, 25},	// ~   ASCII 126
 	};
-#endif	//End of Font file
\ No newline at end of file
+#endif	//End of Font file
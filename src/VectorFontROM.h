@@ -42,6 +42,7 @@
  *      the EOC bit set.
  *
  *	20180522 Rev 0.1 E.Andrews	Improve &, P, R pattern
+ *	20261017 Rev 0.2	Tables made static const (PROGMEM) and included at file scope so they live in flash, not in the XYscope object
  */
 
 #ifndef VECTORFONTROM_H_
@@ -49,15 +50,15 @@
 
 //Define Stroke_Font EOC  (End_Of_Character) flag.
 //This flag tells plotChar when the end of a character in the FontROM has been reached (time to plotting data for the current character)
-uint8_t const EOC = 0x80;			//End of Character Flag (hi-order bit=1)
+static const uint8_t EOC = 0x80;			//End of Character Flag (hi-order bit=1)
 
 //Define Stroke_Font OpCodes (with EOC flag NOT SET); These codes are used within the FontROM data structure and which is the core of the plotChar routine
-uint8_t const NOP = 0x0, PNT = 0x1, LIN = 0x2, REC = 0x3, CIR = 0x4, ELP = 0x5;	//NOP = No Operation, PNT = plot a single POINT, LIN = Plot a LINE
+static const uint8_t NOP = 0x0, PNT = 0x1, LIN = 0x2, REC = 0x3, CIR = 0x4, ELP = 0x5;	//NOP = No Operation, PNT = plot a single POINT, LIN = Plot a LINE
 																				//REC = Plot a Rectangle, CIR = Plot a fully closed Circle or just some circular segment(s)
 																				//ELP = Plot a fully closed Ellipse or just some elliptical segment(s).
 
 //Define Stroke_Font OpCodes with EOC flag SET (Opcodes OR EOC_Flag)
-uint8_t const NOP_E = NOP | EOC, PNT_E = PNT | EOC, LIN_E = LIN | EOC, REC_E =
+static const uint8_t NOP_E = NOP | EOC, PNT_E = PNT | EOC, LIN_E = LIN | EOC, REC_E =
 		REC | EOC, CIR_E = CIR | EOC, ELP_E = ELP | EOC;	//Note, EOC = End Of Character bit that is OR'd wiht the opcode to becomes the MSB of each opcode. 
 															//In this way, when the opcode is 'negative' (EOC bit set), it means this graphic element is the
 															//last one needed to paint the character and the character plotting routine ends.  This means
@@ -71,7 +72,7 @@ struct FontROM {
 					// When a SegmentFlag is set to 1, plot the segment; when set to 0, do not plot (skip) the segment
 };
 
-FontROM DigitFont[280] PROGMEM= {
+static const FontROM DigitFont[280] PROGMEM= {
 
 	{	NOP_E,0x0,0x0,0x00},    // ASCII: 32   SP   (Space)
 
@@ -444,263 +445,263 @@ FontROM DigitFont[280] PROGMEM= {
 // Primatives) are then plotted until the EOC (End Of Character) bit is detected, at which time the
 // last feature is plotted and then DigitFont[] scanning stops and plotting ends.
 //
-uint16_t Ascii2Font[260] PROGMEM= {	//bits 0-8 = Pointer into VectorFontROM, bits 9-15 = Prop Character Width
-	Ascii2Font[0] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[1] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[2] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[3] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[4] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[5] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[6] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[7] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[8] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[9] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[10] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[11] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[12] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[13] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[14] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[15] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[16] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[17] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[18] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[19] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[20] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[21] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[22] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[23] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[24] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[25] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[26] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[27] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[28] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[29] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[30] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[31] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[32] = 4608,// ASCII: 32   SP   (Space)
-	Ascii2Font[33] = 2561,// ASCII: 33   !   (Exclamation mark)
-	Ascii2Font[34] = 3075,// ASCII: 34   "   (Quotation mark (&quot; in HTML))
-	Ascii2Font[35] = 4101,// ASCII: 35   #   (Cross hatch (number sign))
-	Ascii2Font[36] = 3593,// ASCII: 36   $   (Dollar sign)
-	Ascii2Font[37] = 4108,// ASCII: 37   %   (Percent sign)
-	Ascii2Font[38] = 4111,// ASCII: 38   &   (Ampersand)
-	Ascii2Font[39] = 2580,// ASCII: 39   `   (Closing single quote (apostrophe))
-	Ascii2Font[40] = 2581,// ASCII: 40   (   (Opening parentheses)
-	Ascii2Font[41] = 2582,// ASCII: 41   )   (Closing parentheses)
-	Ascii2Font[42] = 4631,// ASCII: 42   *   (Asterisk (star, multiply))
-	Ascii2Font[43] = 4635,// ASCII: 43   +   (Plus)
-	Ascii2Font[44] = 2589,// ASCII: 44   ,   (Comma)
-	Ascii2Font[45] = 4639,// ASCII: 45   -   (Hyphen, dash, minus)
-	Ascii2Font[46] = 4640,// ASCII: 46   .   (Period)
-	Ascii2Font[47] = 4129,// ASCII: 47   /   (Slant (forward slash, divide))
-	Ascii2Font[48] = 4642,// ASCII: 48   0   (Zero)
-	Ascii2Font[49] = 4644,// ASCII: 49   1   (One)
-	Ascii2Font[50] = 4647,// ASCII: 50   2   (Two)
-	Ascii2Font[51] = 4653,// ASCII: 51   3   (Three)
-	Ascii2Font[52] = 4655,// ASCII: 52   4   (Four)
-	Ascii2Font[53] = 4658,// ASCII: 53   5   (Five)
-	Ascii2Font[54] = 4662,// ASCII: 54   6   (Six)
-	Ascii2Font[55] = 4664,// ASCII: 55   7   (Seven)
-	Ascii2Font[56] = 4666,// ASCII: 56   8   (Eight)
-	Ascii2Font[57] = 4668,// ASCII: 57   9   (Nine)
-	Ascii2Font[58] = 3646,// ASCII: 58   :   (Colon)
-	Ascii2Font[59] = 3648,// ASCII: 59   ;   (Semicolon)
-	Ascii2Font[60] = 3651,// ASCII: 60   <   (Less than sign (&lt; in HTML))
-	Ascii2Font[61] = 3653,// ASCII: 61   =   (Equals sign)
-	Ascii2Font[62] = 3143,// ASCII: 62   >   (Greater than sign (&gt; in HTML))
-	Ascii2Font[63] = 3657,// ASCII: 63   ?   (Question mark)
-	Ascii2Font[64] = 4684,// ASCII: 64   @   (At-sign)
-	Ascii2Font[65] = 4689,// ASCII: 65   A   (Uppercase A)
-	Ascii2Font[66] = 4180,// ASCII: 66   B   (Uppercase B)
-	Ascii2Font[67] = 4186,// ASCII: 67   C   (Uppercase C)
-	Ascii2Font[68] = 4187,// ASCII: 68   D   (Uppercase D)
-	Ascii2Font[69] = 4191,// ASCII: 69   E   (Uppercase E)
-	Ascii2Font[70] = 4195,// ASCII: 70   F   (Uppercase F)
-	Ascii2Font[71] = 4198,// ASCII: 71   G   (Uppercase G)
-	Ascii2Font[72] = 4201,// ASCII: 72   H   (Uppercase H)
-	Ascii2Font[73] = 3692,// ASCII: 73   I   (Uppercase I)
-	Ascii2Font[74] = 4207,// ASCII: 74   J   (Uppercase J)
-	Ascii2Font[75] = 4210,// ASCII: 75   K   (Uppercase K)
-	Ascii2Font[76] = 4213,// ASCII: 76   L   (Uppercase L)
-	Ascii2Font[77] = 4727,// ASCII: 77   M   (Uppercase M)
-	Ascii2Font[78] = 4219,// ASCII: 78   N   (Uppercase N)
-	Ascii2Font[79] = 4734,// ASCII: 79   O   (Uppercase O)
-	Ascii2Font[80] = 4223,// ASCII: 80   P   (Uppercase P)
-	Ascii2Font[81] = 4741,// ASCII: 81   Q   (Uppercase Q)
-	Ascii2Font[82] = 4231,// ASCII: 82   R   (Uppercase R)
-	Ascii2Font[83] = 4238,// ASCII: 83   S   (Uppercase S)
-	Ascii2Font[84] = 4752,// ASCII: 84   T   (Uppercase T)
-	Ascii2Font[85] = 4755,// ASCII: 85   U   (Uppercase U)
-	Ascii2Font[86] = 4758,// ASCII: 86   V   (Uppercase V)
-	Ascii2Font[87] = 5784,// ASCII: 87   W   (Uppercase W)
-	Ascii2Font[88] = 4764,// ASCII: 88   X   (Uppercase X)
-	Ascii2Font[89] = 4766,// ASCII: 89   Y   (Uppercase Y)
-	Ascii2Font[90] = 4769,// ASCII: 90   Z   (Uppercase Z)
-	Ascii2Font[91] = 2724,// ASCII: 91   [   (Opening square bracket)
-	Ascii2Font[92] = 4263,// ASCII: 92   \   (Reverse slant (Backslash))
-	Ascii2Font[93] = 2728,// ASCII: 93   ]   (Closing square bracket)
-	Ascii2Font[94] = 3755,// ASCII: 94   ^   (Caret (Circumflex))
-	Ascii2Font[95] = 4269,// ASCII: 95   _   (Underscore)
-	Ascii2Font[96] = 3246,// ASCII: 96   `   (Opening single quote)
-	Ascii2Font[97] = 3759,// ASCII: 97   a   (Lowercase a)
-	Ascii2Font[98] = 3761,// ASCII: 98   b   (Lowercase b)
-	Ascii2Font[99] = 3251,// ASCII: 99   c   (Lowercase c)
-	Ascii2Font[100] = 3764,// ASCII: 100   d   (Lowercase d)
-	Ascii2Font[101] = 3766,// ASCII: 101   e   (Lowercase e)
-	Ascii2Font[102] = 3256,// ASCII: 102   f   (Lowercase f)
-	Ascii2Font[103] = 3771,// ASCII: 103   g   (Lowercase g)
-	Ascii2Font[104] = 3774,// ASCII: 104   h   (Lowercase h)
-	Ascii2Font[105] = 2753,// ASCII: 105   i   (Lowercase i)
-	Ascii2Font[106] = 2755,// ASCII: 106   j   (Lowercase j)
-	Ascii2Font[107] = 3782,// ASCII: 107   k   (Lowercase k)
-	Ascii2Font[108] = 2249,// ASCII: 108   l   (Lowercase l)
-	Ascii2Font[109] = 5323,// ASCII: 109   m   (Lowercase m)
-	Ascii2Font[110] = 3792,// ASCII: 110   n   (Lowercase n)
-	Ascii2Font[111] = 3795,// ASCII: 111   o   (Lowercase o)
-	Ascii2Font[112] = 3796,// ASCII: 112   p   (Lowercase p)
-	Ascii2Font[113] = 3798,// ASCII: 113   q   (Lowercase q)
-	Ascii2Font[114] = 3800,// ASCII: 114   r   (Lowercase r)
-	Ascii2Font[115] = 3802,// ASCII: 115   s   (Lowercase s)
-	Ascii2Font[116] = 3804,// ASCII: 116   t   (Lowercase t)
-	Ascii2Font[117] = 3807,// ASCII: 117   u   (Lowercase u)
-	Ascii2Font[118] = 3810,// ASCII: 118   v   (Lowercase v)
-	Ascii2Font[119] = 5860,// ASCII: 119   w   (Lowercase w)
-	Ascii2Font[120] = 3816,// ASCII: 120   x   (Lowercase x)
-	Ascii2Font[121] = 3818,// ASCII: 121   y   (Lowercase y)
-	Ascii2Font[122] = 3308,// ASCII: 122   z   (Lowercase z)
-	Ascii2Font[123] = 2799,// ASCII: 123   {   (Opening curly brace)
-	Ascii2Font[124] = 2293,// ASCII: 124   |   (Vertical line)
-	Ascii2Font[125] = 2806,// ASCII: 125   }   (Closing curly brace)
-	Ascii2Font[126] = 3836,// ASCII: 126   ~   (Tilde (approximate))
-	Ascii2Font[127] = 4350,// ASCII: 127   DEL   (Delete (rubout), cross-hatch box)
-	Ascii2Font[128] = 6913,//
-	Ascii2Font[129] = 7429,//
-	Ascii2Font[130] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[131] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[132] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[133] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[134] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[135] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[136] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[137] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[138] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[139] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[140] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[141] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[142] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[143] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[144] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[145] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[146] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[147] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[148] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[149] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[150] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[151] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[152] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[153] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[154] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[155] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[156] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[157] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[158] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[159] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[160] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[161] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[162] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[163] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[164] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[165] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[166] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[167] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[168] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[169] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[170] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[171] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[172] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[173] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[174] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[175] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[176] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[177] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[178] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[179] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[180] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[181] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[182] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[183] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[184] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[185] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[186] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[187] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[188] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[189] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[190] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[191] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[192] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[193] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[194] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[195] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[196] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[197] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[198] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[199] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[200] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[201] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[202] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[203] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[204] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[205] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[206] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[207] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[208] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[209] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[210] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[211] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[212] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[213] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[214] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[215] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[216] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[217] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[218] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[219] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[220] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[221] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[222] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[223] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[224] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[225] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[226] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[227] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[228] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[229] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[230] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[231] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[232] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[233] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[234] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[235] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[236] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[237] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[238] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[239] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[240] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[241] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[242] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[243] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[244] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[245] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[246] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[247] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[248] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[249] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[250] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[251] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[252] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[253] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[254] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
-	Ascii2Font[255] = 4860,//No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+static const uint16_t Ascii2Font[260] PROGMEM= {	//bits 0-8 = Pointer into VectorFontROM, bits 9-15 = Prop Character Width
+	4860,	//[0] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[1] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[2] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[3] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[4] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[5] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[6] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[7] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[8] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[9] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[10] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[11] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[12] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[13] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[14] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[15] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[16] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[17] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[18] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[19] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[20] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[21] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[22] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[23] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[24] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[25] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[26] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[27] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[28] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[29] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[30] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[31] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4608,	//[32]  ASCII: 32   SP   (Space)
+	2561,	//[33]  ASCII: 33   !   (Exclamation mark)
+	3075,	//[34]  ASCII: 34   "   (Quotation mark (&quot; in HTML))
+	4101,	//[35]  ASCII: 35   #   (Cross hatch (number sign))
+	3593,	//[36]  ASCII: 36   $   (Dollar sign)
+	4108,	//[37]  ASCII: 37   %   (Percent sign)
+	4111,	//[38]  ASCII: 38   &   (Ampersand)
+	2580,	//[39]  ASCII: 39   `   (Closing single quote (apostrophe))
+	2581,	//[40]  ASCII: 40   (   (Opening parentheses)
+	2582,	//[41]  ASCII: 41   )   (Closing parentheses)
+	4631,	//[42]  ASCII: 42   *   (Asterisk (star, multiply))
+	4635,	//[43]  ASCII: 43   +   (Plus)
+	2589,	//[44]  ASCII: 44   ,   (Comma)
+	4639,	//[45]  ASCII: 45   -   (Hyphen, dash, minus)
+	4640,	//[46]  ASCII: 46   .   (Period)
+	4129,	//[47]  ASCII: 47   /   (Slant (forward slash, divide))
+	4642,	//[48]  ASCII: 48   0   (Zero)
+	4644,	//[49]  ASCII: 49   1   (One)
+	4647,	//[50]  ASCII: 50   2   (Two)
+	4653,	//[51]  ASCII: 51   3   (Three)
+	4655,	//[52]  ASCII: 52   4   (Four)
+	4658,	//[53]  ASCII: 53   5   (Five)
+	4662,	//[54]  ASCII: 54   6   (Six)
+	4664,	//[55]  ASCII: 55   7   (Seven)
+	4666,	//[56]  ASCII: 56   8   (Eight)
+	4668,	//[57]  ASCII: 57   9   (Nine)
+	3646,	//[58]  ASCII: 58   :   (Colon)
+	3648,	//[59]  ASCII: 59   ;   (Semicolon)
+	3651,	//[60]  ASCII: 60   <   (Less than sign (&lt; in HTML))
+	3653,	//[61]  ASCII: 61   =   (Equals sign)
+	3143,	//[62]  ASCII: 62   >   (Greater than sign (&gt; in HTML))
+	3657,	//[63]  ASCII: 63   ?   (Question mark)
+	4684,	//[64]  ASCII: 64   @   (At-sign)
+	4689,	//[65]  ASCII: 65   A   (Uppercase A)
+	4180,	//[66]  ASCII: 66   B   (Uppercase B)
+	4186,	//[67]  ASCII: 67   C   (Uppercase C)
+	4187,	//[68]  ASCII: 68   D   (Uppercase D)
+	4191,	//[69]  ASCII: 69   E   (Uppercase E)
+	4195,	//[70]  ASCII: 70   F   (Uppercase F)
+	4198,	//[71]  ASCII: 71   G   (Uppercase G)
+	4201,	//[72]  ASCII: 72   H   (Uppercase H)
+	3692,	//[73]  ASCII: 73   I   (Uppercase I)
+	4207,	//[74]  ASCII: 74   J   (Uppercase J)
+	4210,	//[75]  ASCII: 75   K   (Uppercase K)
+	4213,	//[76]  ASCII: 76   L   (Uppercase L)
+	4727,	//[77]  ASCII: 77   M   (Uppercase M)
+	4219,	//[78]  ASCII: 78   N   (Uppercase N)
+	4734,	//[79]  ASCII: 79   O   (Uppercase O)
+	4223,	//[80]  ASCII: 80   P   (Uppercase P)
+	4741,	//[81]  ASCII: 81   Q   (Uppercase Q)
+	4231,	//[82]  ASCII: 82   R   (Uppercase R)
+	4238,	//[83]  ASCII: 83   S   (Uppercase S)
+	4752,	//[84]  ASCII: 84   T   (Uppercase T)
+	4755,	//[85]  ASCII: 85   U   (Uppercase U)
+	4758,	//[86]  ASCII: 86   V   (Uppercase V)
+	5784,	//[87]  ASCII: 87   W   (Uppercase W)
+	4764,	//[88]  ASCII: 88   X   (Uppercase X)
+	4766,	//[89]  ASCII: 89   Y   (Uppercase Y)
+	4769,	//[90]  ASCII: 90   Z   (Uppercase Z)
+	2724,	//[91]  ASCII: 91   [   (Opening square bracket)
+	4263,	//[92]  ASCII: 92   \   (Reverse slant (Backslash))
+	2728,	//[93]  ASCII: 93   ]   (Closing square bracket)
+	3755,	//[94]  ASCII: 94   ^   (Caret (Circumflex))
+	4269,	//[95]  ASCII: 95   _   (Underscore)
+	3246,	//[96]  ASCII: 96   `   (Opening single quote)
+	3759,	//[97]  ASCII: 97   a   (Lowercase a)
+	3761,	//[98]  ASCII: 98   b   (Lowercase b)
+	3251,	//[99]  ASCII: 99   c   (Lowercase c)
+	3764,	//[100]  ASCII: 100   d   (Lowercase d)
+	3766,	//[101]  ASCII: 101   e   (Lowercase e)
+	3256,	//[102]  ASCII: 102   f   (Lowercase f)
+	3771,	//[103]  ASCII: 103   g   (Lowercase g)
+	3774,	//[104]  ASCII: 104   h   (Lowercase h)
+	2753,	//[105]  ASCII: 105   i   (Lowercase i)
+	2755,	//[106]  ASCII: 106   j   (Lowercase j)
+	3782,	//[107]  ASCII: 107   k   (Lowercase k)
+	2249,	//[108]  ASCII: 108   l   (Lowercase l)
+	5323,	//[109]  ASCII: 109   m   (Lowercase m)
+	3792,	//[110]  ASCII: 110   n   (Lowercase n)
+	3795,	//[111]  ASCII: 111   o   (Lowercase o)
+	3796,	//[112]  ASCII: 112   p   (Lowercase p)
+	3798,	//[113]  ASCII: 113   q   (Lowercase q)
+	3800,	//[114]  ASCII: 114   r   (Lowercase r)
+	3802,	//[115]  ASCII: 115   s   (Lowercase s)
+	3804,	//[116]  ASCII: 116   t   (Lowercase t)
+	3807,	//[117]  ASCII: 117   u   (Lowercase u)
+	3810,	//[118]  ASCII: 118   v   (Lowercase v)
+	5860,	//[119]  ASCII: 119   w   (Lowercase w)
+	3816,	//[120]  ASCII: 120   x   (Lowercase x)
+	3818,	//[121]  ASCII: 121   y   (Lowercase y)
+	3308,	//[122]  ASCII: 122   z   (Lowercase z)
+	2799,	//[123]  ASCII: 123   {   (Opening curly brace)
+	2293,	//[124]  ASCII: 124   |   (Vertical line)
+	2806,	//[125]  ASCII: 125   }   (Closing curly brace)
+	3836,	//[126]  ASCII: 126   ~   (Tilde (approximate))
+	4350,	//[127]  ASCII: 127   DEL   (Delete (rubout), cross-hatch box)
+	6913,	//[128] 
+	7429,	//[129] 
+	4860,	//[130] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[131] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[132] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[133] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[134] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[135] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[136] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[137] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[138] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[139] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[140] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[141] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[142] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[143] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[144] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[145] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[146] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[147] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[148] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[149] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[150] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[151] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[152] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[153] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[154] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[155] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[156] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[157] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[158] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[159] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[160] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[161] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[162] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[163] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[164] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[165] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[166] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[167] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[168] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[169] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[170] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[171] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[172] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[173] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[174] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[175] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[176] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[177] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[178] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[179] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[180] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[181] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[182] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[183] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[184] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[185] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[186] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[187] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[188] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[189] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[190] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[191] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[192] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[193] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[194] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[195] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[196] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[197] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[198] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[199] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[200] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[201] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[202] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[203] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[204] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[205] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[206] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[207] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[208] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[209] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[210] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[211] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[212] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[213] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[214] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[215] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[216] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[217] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[218] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[219] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[220] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[221] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[222] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[223] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[224] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[225] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[226] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[227] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[228] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[229] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[230] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[231] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[232] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[233] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[234] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[235] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[236] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[237] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[238] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[239] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[240] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[241] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[242] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[243] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[244] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[245] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[246] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[247] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[248] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[249] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[250] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[251] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[252] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[253] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[254] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
+	4860,	//[255] No symbol defined in FontROM. As a diagnostic helper, show a TILDE symbol
 
 };
 
@@ -1,26 +1,66 @@
 #include "XYscope.h"
 #include "XYscopeConfig.h"
+#include "SineTableROM.h"		//Quarter-wave sine table for the integer circle & ellipse steppers
+
+//Font ROMs are shared, flash-resident (static const / PROGMEM) tables at file scope; they are
+//not part of the XYscope object, so they cost no RAM per instance.
+#if CFG_IncludeVectorFontROM == true
+	#include "VectorFontROM.h"		//Include Font ROM file
+#endif
+
+#if CFG_IncludeHersheyFontROM == true
+	#include "HersheyFontROM.h"
+#endif
 
 
 
 
 
-#if defined CFG_PioPositiveBlankingLogic
-	#define BlankOutput digitalWrite(CFG_Z_blank_pin,LOW)		//TEENSY Macro to blank CRT, LOGIC 1 = BEAM ON
-	#define UnblankOutput digitalWrite(CFG_Z_blank_pin,HIGH)	//TEENSY Macro to unblank CRT, LOGIC 1 = BEAM ON
-#else
-	#define BlankOutput digitalWrite(CFG_Z_blank_pin,HIGH)		//TEENSY Macro to blank CRT, LOGIC 1 = BEAM OFF
-	#define UnblankOutput digitalWrite(CFG_Z_blank_pin,LOW)		//TEENSY Macro to unblank CRT, LOGIC 1 = BEAM OFF
+//Blanking macros, the DUE refresh timer and the DAC/DMA hardware code are in the output backends (XYscopeBackend.h)
+
+#if defined(XYSCOPE_HOST)
+	//----------------------------------------------------    
+	//  HOST SIMULATION BACKEND STATE
+	//----------------------------------------------------	
+	uint64_t HostSimOutput::now_ps = 0;
+	uint32_t HostSimOutput::cycle_ps = 1000000000000ULL / F_CPU;	//One CPU cycle
+	uint32_t HostSimOutput::dacWrite_ps = 4000000000000ULL / F_CPU;	//Two 16 bit DAC register stores (~4 cycles)
+	uint32_t HostSimOutput::pinWrite_ps = 2000000000000ULL / F_CPU;	//One GPIO register store (~2 cycles)
+	uint32_t HostSimOutput::dacWrites = 0, HostSimOutput::unblanks = 0, HostSimOutput::paints = 0;
+	uint64_t HostSimOutput::beamOn_ps = 0;
+	uint16_t HostSimOutput::dacX = 0, HostSimOutput::dacY = 0;
+	bool HostSimOutput::beamOn = false;
+	long HostSimOutput::refreshPeriod_us = 0;
+	void (*HostSimOutput::trace)(const XYscopeSimEvent &e) = NULL;
+	void (*HostSimOutput::sliceIsr)(void) = NULL;
+	bool HostSimOutput::sliceRunning = false, HostSimOutput::slicePending = false;
 #endif
 
-#if defined(__SAM3X8E__)
+#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
 	//----------------------------------------------------    
-	//  DUE CODE BLOCK
+	//  DMA SAMPLE SCHEDULE STATE (CFG_TnsyDmaPaint)
 	//----------------------------------------------------	
-	//This timer is only used when working with Arduino DUE
-	#include <DueTimer.h>	//Timer library for DUE; download this library from the Arduino.org site
-							//Timer library is also available from author at https://github.com/ivanseidel/DueTimer
+	uint32_t DmaSchedule::z[DmaSchedule::RingSamples];
+	uint32_t DmaSchedule::xy[DmaSchedule::RingSamples];
+	uint32_t DmaSchedule::zMask = 0;
+	uint32_t DmaSchedule::cycle_ps = 1000000000000ULL / F_CPU;	//One CPU cycle (delays are given in cycles)
+	uint32_t DmaSchedule::sample_ps = CFG_TnsyDmaSampleNs * 1000UL;
+	uint32_t DmaSchedule::curXY = 0, DmaSchedule::pendingZ = 0;
+	uint16_t DmaSchedule::next = 0, DmaSchedule::end = 0;
+	uint32_t DmaSchedule::delayCycles_n = 0;
+	bool DmaSchedule::beamOn = false;
 #endif
+#if defined(__MK66FX1M0__)
+	DMAChannel TeensyDmaOutput::zDma, TeensyDmaOutput::xyDma;
+#endif
+#if defined(XYSCOPE_HOST)
+	void (*HostDmaOutput::isr)(void) = NULL;
+	bool HostDmaOutput::running = false;
+	uint8_t HostDmaOutput::lastHalf = 0;
+	uint32_t HostDmaOutput::halvesSent = 0;
+#endif
+
+XYscope *XYscope::_sliceOwner = NULL;	//Instance painted by the sliced paint & DMA interrupts (see paintSliceIsr, dmaHalfIsr)
 
 uint8_t TimerBlinkState = 0;
 
@@ -28,6 +68,90 @@ uint8_t TimerBlinkState = 0;
 
 XYscope::XYscope() {
 	//Initialize variables used in these routines
+
+	//Start out building into (and painting from) the first XY_List buffer
+	_backIndex = 0;
+	XY_List = XY_ListPool[_backIndex];
+	XYlistEnd = 0;
+	_paintList = XY_List;
+	_paintEnd = 0;
+	_pendingList = XY_List;
+	_pendingEnd = 0;
+	_commitPending = false;
+
+	//No segments yet; paint just the XY_List
+	_segCount = 0;
+	_segPoolUsed = 0;
+	_segActive = -1;
+	_segInScratch = false;
+
+	//No sprites yet
+	_spriteCount = 0;
+	_spritePoolUsed = 0;
+	_spriteRecStart = -1;
+
+	//No 2D transform
+	resetTransform();
+	_paintRuns[0].list = _paintList;
+	_paintRuns[0].end = 0;
+	_paintRunCount = 1;
+	_paintPointCount = 0;
+	_dmaRun = 0;
+	_dmaPos = 0;
+	_dmaStage = DmaDraining;
+	_dmaPadPoints = 0;
+	_paintActive = false;
+
+	//Text is left justified until printSetup() asks otherwise
+	_fontJustifyFlag = LtJustify;
+	_fontJustifyEnab = 0;
+
+	//Level Of Detail starts out as set in XYscopeConfig.h (full detail until the first paint has been timed)
+	_lodRefreshUs = CFG_LodRefresh_us;
+	_lodLevel = 0;
+	_lodPointsPainted = 0;
+	_lodPointsDropped = 0;
+
+	//Paint time cost model starts out uncorrected, with nothing plotted
+	_buildLargeSteps = 0;
+	_pendingLargeSteps = 0;
+	_paintLargeSteps = 0;
+	_segSavedLargeSteps = 0;
+	_paintLargeCount = 0;
+	_costGainQ16 = 65536;
+	predicted_PaintTimeUs = 0;
+
+	//Sliced paint: no frame in progress, no statistics yet
+	_psActive = false;
+	_ps.screenSaved = false;
+	_slicePoints = 0;
+	_sliceMaxUs = 0;
+	_refreshJitterUs = 0;
+	_jitterExpectedUs = 0;
+	_frameJitterUs = 0;
+	_frameNext = 0;
+	_frameCount = 0;
+	_dmaDrain = 0;
+
+	//Glyph cache starts out empty
+	glyphCacheClear();
+
+	//Beam path optimizer starts out as set in XYscopeConfig.h
+	_beamPathOn = CFG_BeamPathOptimizer;
+	_beamPathBudgetUs = CFG_BeamPathBudgetUs;
+	_beamPathJumpsSaved = 0;
+	_beamPathSettleSaved = 0;
+
+	//Settle & unblank delays in CPU cycles (recomputed from the Pio...Ns values at every paint)
+	_smallSettleCycles = nsToCycles(PioSmallSettleNs);
+	_largeSettleCycles = nsToCycles(PioLargeSettleNs);
+	_unblankCycles = nsToCycles(PioUnblankNs);
+
+	//Primitive display list starts out empty
+	_primCount = 0;
+	_primPointsPainted = 0;
+	primRasterStart();
+
 	#if defined(__SAM3X8E__)
 		//----------------------------------------------------    
 		//  DUE CODE BLOCK
@@ -202,12 +326,16 @@ void XYscope::plotClear(void) {
 	//	Returns: NOTHING (Sets global variable, XYlistEnd = 0)
 	//
 	//	20170705 Ver 2.0	E.Andrews	Simplified call by eliminating all passed parameters
+	//	20261017 Ver 2.1				Also empties all retained segments and the primitive display list
 
-	//	Just reset the array pointers and display goes blank
+	//	Just reset the array pointers (and empty any segments & primitives) and display goes blank
+	for (int seg = 0; seg < _segCount; seg++) segmentClear(seg);
+	primClear();
 	XYlistEnd = 0;
 	//Now initialize the first entry into the XYlist array using the plotStart() function
 	plotStart();
 	plotEnd();
+	if (CFG_DoubleBufferXYlist) plotCommit();	//Double buffered lists must be handed to the refresh routine to take effect
 	//AutoSetRefreshTime();
 	return;
 }
@@ -222,7 +350,13 @@ void XYscope::plotEnd() {
 	//
 	//	20170705 Ver 0.1	E.Andrews	First cut of simplified routine (no passed parameters)
 	//	20180425 Ver 1.0	E.Andrews	Add TEENSY PIO compatibility
+	//	20261017 Ver 1.1				Runs the beam path optimizer (CFG_BeamPathOptimizer) on the finished list
+	//	20261017 Ver 1.2				Single buffered XY_List: sets the refresh period for the finished list (cost model)
 	//
+	beamPathOptimize();
+	#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		if (!CFG_DoubleBufferXYlist && _segActive < 0) autoSetRefreshTime();	//plotCommit() & segmentEnd() do it for theirs
+	#endif
 	
 	#if defined(__SAM3X8E__)
 		//----------------------------------------------------    
@@ -248,6 +382,751 @@ void XYscope::plotEnd() {
 	return;
 }
 
+void XYscope::plotCommit() {
+	//	Routine hands the just-completed display list over to the refresh (paint) routines.
+	//
+	//	When CFG_DoubleBufferXYlist is 'true', points are built into a BACK buffer while the refresh routine
+	//	paints from a separate FRONT buffer.  plotCommit() marks the back buffer as ready and makes the other
+	//	buffer the new back buffer.  Nothing is copied; the actual front/back swap happens at the start of the
+	//	next paint cycle so a partially built list is never shown.  The next plotStart() will wait for that swap.
+	//
+	//	When CFG_DoubleBufferXYlist is 'false' there is only one list and this routine simply calls plotEnd().
+	//
+	//	Calling parameters: NONE
+	//	Returns: NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	plotEnd();
+	if (!CFG_DoubleBufferXYlist) return;
+
+	noInterrupts();
+		_pendingList = XY_List;
+		_pendingEnd = XYlistEnd;
+		_pendingLargeSteps = _buildLargeSteps;
+		_commitPending = true;
+		_backIndex = (_backIndex + 1) % XYlistBufferCount;
+		XY_List = XY_ListPool[_backIndex];
+		XYlistEnd = 0;
+		_buildLargeSteps = 0;
+	interrupts();
+	#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		autoSetRefreshTime();	//Set the refresh period for the new frame before it is painted (cost model)
+	#endif
+	return;
+}
+
+inline long XYscope::beamPathCost(const pointList &a, const pointList &b) {
+	//Cost of a beam jump: the biggest of the X & Y moves (the DACs move both at once), plus a full screen
+	//width if it is a Large Step so that getting rid of Large Steps always wins over shortening small ones
+	int d = max(abs((a.X & 0xfff) - (b.X & 0xfff)), abs((a.Y & 0xfff) - (b.Y & 0xfff)));
+	return d > NoSettlingTimeReqd ? d + 4096 : d;
+}
+
+inline XYscope::pointList &XYscope::strokeEntry(uint16_t o) {
+	//First point painted of stroke table entry 'o' (bit 15 set = stroke is painted backwards)
+	uint16_t s = o & 0x7fff;
+	return (o & 0x8000) ? XY_List[_strokeStart[s + 1] - 1] : XY_List[_strokeStart[s]];
+}
+
+inline XYscope::pointList &XYscope::strokeExit(uint16_t o) {
+	//Last point painted of stroke table entry 'o'
+	uint16_t s = o & 0x7fff;
+	return (o & 0x8000) ? XY_List[_strokeStart[s]] : XY_List[_strokeStart[s + 1] - 1];
+}
+
+void XYscope::beamPathOptimize(void) {
+	//	Beam path optimizer.  Re-orders the strokes of XY_List[0..XYlistEnd-1] (the XY_List, or the segment
+	//	being built) so the beam makes as few Large Step jumps as it can between them.
+	//
+	//	A stroke is a run of points that starts with a Large Step (SettleLong_flag, see settleAnnotate) and
+	//	has none inside it: a line, a circle, a character, or several figures that happen to touch.  The first
+	//	stroke (and the DUE sync pulse) stays put; the others are put in nearest neighbor order, then improved
+	//	with 2-opt moves (which also turn strokes around) until no move helps or _beamPathBudgetUs runs out.
+	//	The new order is built in the free tail of the XY_List and copied back only if it is better.
+	//	Points inside a stroke keep their order, so the picture itself does not change.
+	//
+	//	Calling parameters: NONE
+	//	Returns: NOTHING (getBeamPathJumpsSaved()/getBeamPathSettleSaved() return the results)
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Interrupts stay on for the copy back when the list is not painted (back buffer or segment)
+	//
+	if (!_beamPathOn || MaxStrokes < 3) return;
+	unsigned long startUs = micros();
+	int fixedEnd = 1;					//Points that must stay at the front of the list
+	#if defined(__SAM3X8E__)
+		if (_segActive < 0) fixedEnd = 4;	//DUE: Keep the sync pulse (see plotStart)
+	#endif
+
+	//Split the list into strokes at the Large Steps.  If the table fills up, the last stroke holds the rest of the list
+	int n = 0, i, j, k;
+	_strokeStart[n++] = 0;
+	for (i = fixedEnd; i < XYlistEnd && n < MaxStrokes; i++)
+		if (XY_List[i].X & SettleLong_flag) _strokeStart[n++] = i;
+	_strokeStart[n] = XYlistEnd;
+	if (n < 3) return;
+
+	long oldCost = 0;
+	for (k = 0; k < n; k++) _strokeOrder[k] = k;
+	for (k = 1; k < n; k++) oldCost += beamPathCost(strokeExit(k - 1), strokeEntry(k));
+
+	//Nearest neighbor: pick the closest end of the strokes not yet placed.  Out of time = the rest stay as they are
+	for (k = 1; k < n; k++) {
+		if (micros() - startUs > _beamPathBudgetUs) break;
+		const pointList &from = strokeExit(_strokeOrder[k - 1]);
+		long best = 0x7fffffff;
+		int bestJ = k;
+		uint16_t bestO = _strokeOrder[k];
+		for (j = k; j < n; j++) {
+			uint16_t s = _strokeOrder[j];
+			long c = beamPathCost(from, XY_List[_strokeStart[s]]);
+			if (c < best) {best = c; bestJ = j; bestO = s;}
+			c = beamPathCost(from, XY_List[_strokeStart[s + 1] - 1]);
+			if (c < best) {best = c; bestJ = j; bestO = s | 0x8000;}
+		}
+		_strokeOrder[bestJ] = _strokeOrder[k];
+		_strokeOrder[k] = bestO;
+	}
+
+	//2-opt: painting strokes i..j in reverse order (each one turned around) only changes the jumps into i and out of j
+	bool improved = true;
+	while (improved) {
+		improved = false;
+		for (i = 1; i < n; i++) {
+			if (micros() - startUs > _beamPathBudgetUs) {improved = false; break;}
+			const pointList &a = strokeExit(_strokeOrder[i - 1]);
+			long in = beamPathCost(a, strokeEntry(_strokeOrder[i]));
+			for (j = i; j < n; j++) {
+				long before = in, after = beamPathCost(a, strokeExit(_strokeOrder[j]));
+				if (j + 1 < n) {
+					before += beamPathCost(strokeExit(_strokeOrder[j]), strokeEntry(_strokeOrder[j + 1]));
+					after += beamPathCost(strokeEntry(_strokeOrder[i]), strokeEntry(_strokeOrder[j + 1]));
+				}
+				if (after < before) {
+					for (int lo = i, hi = j; lo <= hi; lo++, hi--) {
+						uint16_t t = _strokeOrder[lo] ^ 0x8000;
+						_strokeOrder[lo] = _strokeOrder[hi] ^ 0x8000;
+						_strokeOrder[hi] = t;
+					}
+					in = beamPathCost(a, strokeEntry(_strokeOrder[i]));
+					improved = true;
+				}
+			}
+		}
+	}
+
+	long newCost = 0;
+	int jumps = 0;
+	for (k = 1; k < n; k++) {
+		long c = beamPathCost(strokeExit(_strokeOrder[k - 1]), strokeEntry(_strokeOrder[k]));
+		newCost += c;
+		if (c > NoSettlingTimeReqd) jumps++;
+	}
+	if (newCost >= oldCost) return;		//Already as good (e.g. plotEnd() called twice)
+
+	//Build the new order in the free tail of the XY_List (not painted).  A segment built in place uses the XY_List's
+	//tail, unless a double buffered commit is pending (the buffer may still be painted)
+	pointList *scratch;
+	if (_segActive >= 0 && !_segInScratch) {
+		if (CFG_DoubleBufferXYlist && _commitPending) return;
+		scratch = &_segSavedList[_segSavedEnd + 2];
+	} else scratch = &XY_List[XYlistEnd + 2];
+	int count = XYlistEnd - _strokeStart[1];
+	if (scratch + count > &XY_ListPool[_backIndex][MaxArraySize]) return;	//Not enough room; leave the list as it is
+
+	pointList *p = scratch;
+	for (k = 1; k < n; k++) {
+		uint16_t s = _strokeOrder[k] & 0x7fff;
+		int first = _strokeStart[s], end = _strokeStart[s + 1];
+		if (_strokeOrder[k] & 0x8000) {
+			while (end > first) *p++ = XY_List[--end];
+		} else {
+			memcpy(p, &XY_List[first], (end - first) * sizeof(pointList));
+			p += end - first;
+		}
+	}
+	if (CFG_DoubleBufferXYlist || _segActive >= 0) {
+		//Back buffer or segment being built: not painted, so the refresh interrupt is never held off for the copy
+		memcpy(&XY_List[_strokeStart[1]], scratch, count * sizeof(pointList));
+		settleAnnotate(_strokeStart[1], XYlistEnd);
+	} else {
+		noInterrupts();		//Single buffered XY_List: don't let a refresh paint a half copied list
+			memcpy(&XY_List[_strokeStart[1]], scratch, count * sizeof(pointList));
+			settleAnnotate(_strokeStart[1], XYlistEnd);
+		interrupts();
+	}
+
+	_beamPathJumpsSaved = (n - 1) - jumps;
+	_beamPathSettleSaved = (long) _beamPathJumpsSaved * ((long) PioLargeSettleNs - PioSmallSettleNs);
+	return;
+}
+
+void XYscope::setBeamPathOptimizer(bool enable, uint16_t budget_us) {
+	//	Turn the beam path optimizer on or off and set the CPU time it may spend on each list.
+	//	Only works when CFG_BeamPathOptimizer is 'true' (otherwise there is no stroke table).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	_beamPathOn = enable;
+	_beamPathBudgetUs = budget_us;
+}
+
+int XYscope::getBeamPathJumpsSaved() {
+	//	Returns the number of Large Step jumps removed by the beam path optimizer from the last list it re-ordered.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _beamPathJumpsSaved;
+}
+
+long XYscope::getBeamPathSettleSaved() {
+	//	Returns the PIO settling time (ns) saved on every refresh of the last list the beam path optimizer
+	//	re-ordered: jumps saved X (PioLargeSettleNs - PioSmallSettleNs).
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	ns instead of NOP counts
+	//
+	return _beamPathSettleSaved;
+}
+
+bool XYscope::plotCommitPending() {
+	//	Returns 'true' while a committed display list is still waiting to be picked up by the refresh routine.
+	//	Always returns 'false' when CFG_DoubleBufferXYlist is 'false'.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _commitPending;
+}
+
+void XYscope::paintListSwap(void) {
+	//	Called at the start of every paint cycle to select the list that will be painted.
+	//	Double buffered: Pick up a committed list (if any); otherwise keep repainting the current front list.
+	//	Single buffered: Paint whatever is in XY_List right now (original behavior); while a segment is being
+	//	built, XY_List points at the segment, so the saved XY_List is painted instead.
+	//
+	//	The routine then builds the paint "run list": the selected list followed by every visible,
+	//	non-empty segment in paint order.  Empty runs are skipped so the paint loops never see them.
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Runs carry their LOD priority (see pioPaint)
+	//	20261017 Ver 0.2	Counts Large Steps for the paint time cost model
+	//
+	uint8_t n = 0;
+	segmentInfo *s;
+
+	if (CFG_DoubleBufferXYlist) {
+		if (_commitPending) {
+			_paintList = _pendingList;
+			_paintEnd = _pendingEnd;
+			_paintLargeSteps = _pendingLargeSteps;
+			_commitPending = false;
+		}
+	} else if (_segActive >= 0) {	//A segment is being built: XY_List is parked in _segSavedList
+		_paintList = _segSavedList;
+		_paintEnd = _segSavedEnd;
+		_paintLargeSteps = _segSavedLargeSteps;
+	} else {
+		_paintList = XY_List;
+		_paintEnd = XYlistEnd;
+		_paintLargeSteps = _buildLargeSteps;
+	}
+
+	_paintPointCount = 0;
+	_paintLargeCount = 0;
+	if (_paintEnd > 0) {
+		_paintRuns[n].list = _paintList;
+		_paintRuns[n].end = _paintEnd;
+		_paintRuns[n].priority = 0;
+		_paintPointCount += _paintEnd;
+		_paintLargeCount += _paintLargeSteps + 1;	//First point of a run is a Large Step (see pioPaint)
+		n++;
+	}
+	for (uint8_t k = 0; k < _segCount; k++) {
+		s = &_seg[_segOrder[k]];
+		if (s->visible && !s->building && s->count > 0) {
+			_paintRuns[n].list = &XY_SegmentPool[s->start];
+			_paintRuns[n].end = s->count;
+			_paintRuns[n].priority = s->priority;
+			_paintPointCount += s->count;
+			_paintLargeCount += s->largeSteps + 1;
+			n++;
+		}
+	}
+	if (n == 0) {	//Nothing to show...Keep a single (empty) run so the paint loops stay simple
+		_paintRuns[n].list = _paintList;
+		_paintRuns[n].end = _paintEnd;
+		_paintRuns[n].priority = 0;
+		n++;
+	}
+	_paintRunCount = n;
+}
+
+int XYscope::segmentCreate(const char *name, int maxPoints) {
+	//	Routine to create a named, retained display-list segment.
+	//
+	//	Segments hold points that are painted AFTER the XY_List, in paint order.  Each segment owns its
+	//	own slice of XY_SegmentPool, so a segment in the middle of the paint order can be cleared and
+	//	rebuilt without touching the points of the XY_List or of any other segment.  Typical use:
+	//	Draw static content (clock face, court, grid) into the XY_List once, and put the moving parts
+	//	(hands, ball, cursor) into segments that are rebuilt with segmentBegin()/segmentEnd().
+	//
+	//	Calling parameters:
+	//		name		Segment name.  Only the pointer is kept, so pass a string literal or other persistent string.
+	//		maxPoints	Max number of points the segment will ever need.  Pool space is reserved now and
+	//					is only given back by segmentDeleteAll().
+	//
+	//	Returns:	Segment handle (0 to CFG_MaxSegments-1), or -1 if all slots are used or the pool is too small.
+	//				If a segment with this name already exists, it is emptied and its handle is returned.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int seg = segmentFind(name);
+	if (seg >= 0) {
+		segmentClear(seg);
+		return seg;
+	}
+	if (_segCount >= CFG_MaxSegments || maxPoints < 1) return -1;
+	if (_segPoolUsed + maxPoints + 1 > SegmentPoolSize) return -1;	//Each segment gets one extra point for plotEnd()
+
+	seg = _segCount;
+	_seg[seg].name = name;
+	_seg[seg].start = _segPoolUsed;
+	_seg[seg].capacity = maxPoints;
+	_seg[seg].count = 0;
+	_seg[seg].visible = true;
+	_seg[seg].building = false;
+	_seg[seg].priority = 0;
+	_seg[seg].largeSteps = 0;
+	_segPoolUsed += maxPoints + 1;
+
+	noInterrupts();
+		_segOrder[seg] = seg;	//New segments are painted last
+		_segCount++;
+	interrupts();
+	return seg;
+}
+
+int XYscope::segmentFind(const char *name) {
+	//	Returns the handle of the segment called 'name', or -1 if there is no such segment.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	for (int seg = 0; seg < _segCount; seg++) {
+		if (strcmp(_seg[seg].name, name) == 0) return seg;
+	}
+	return -1;
+}
+
+void XYscope::segmentBegin(int seg) {
+	//	Routine to start (re)building a segment.  The segment is emptied and, until segmentEnd() is called,
+	//	plotPoint, plotLine, plotCircle, print, etc. write into the segment instead of the XY_List.
+	//	Limit checks work exactly as they do for the XY_List, using the segment's maxPoints as the limit.
+	//
+	//	If the free tail of the XY_List is big enough, the new points are built there and copied into
+	//	the segment at segmentEnd(); the old segment contents keep being painted meanwhile (no flicker).
+	//	Otherwise, the segment is built in place and is hidden from the paint routines until segmentEnd().
+	//	Either way, a half-built segment is never painted.
+	//
+	//	Calling parameters:
+	//		seg		Segment handle from segmentCreate()
+	//
+	//	Returns: NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (seg < 0 || seg >= _segCount || _segActive >= 0) return;
+
+	_segSavedList = XY_List;
+	_segSavedEnd = XYlistEnd;
+	_segSavedMaxBuffSize = MaxBuffSize;
+	_segSavedLargeSteps = _buildLargeSteps;
+	_segActive = seg;	//Set before XY_List moves: a single buffered paint then keeps painting the saved XY_List
+
+	//When double buffered, the back buffer may still be painted until a pending commit is picked up
+	uint32_t scratchStart = XYlistEnd + 2;	//Leave room for plotEnd() & paint over-run of the XY_List
+	if (scratchStart + _seg[seg].capacity + 1 <= MaxArraySize && !(CFG_DoubleBufferXYlist && _commitPending)) {
+		_segInScratch = true;
+		XY_List = &XY_List[scratchStart];
+	} else {
+		_segInScratch = false;
+		segmentWaitPaintIdle();
+			_seg[seg].building = true;
+			_seg[seg].count = 0;
+		interrupts();
+		XY_List = &XY_SegmentPool[_seg[seg].start];
+	}
+	XYlistEnd = 0;
+	_buildLargeSteps = 0;
+	MaxBuffSize = _seg[seg].capacity + 2;	//plotPoint stops at MaxBuffSize-2 points
+	return;
+}
+
+void XYscope::segmentEnd() {
+	//	Routine to finish building the segment started by segmentBegin().  The segment's new points
+	//	are handed to the paint routines and plotting resumes at the end of the XY_List.
+	//
+	//	Calling parameters: NONE
+	//	Returns: NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_segActive < 0) return;
+	segmentInfo *s = &_seg[_segActive];
+	int count = XYlistEnd;
+
+	plotEnd();	//Duplicate the last point just past the end (DUE)
+	if (_segInScratch) {
+		segmentWaitPaintIdle();
+			memcpy(&XY_SegmentPool[s->start], XY_List, (count + 1) * sizeof(pointList));
+			s->count = count;
+			s->largeSteps = _buildLargeSteps;
+		interrupts();
+	} else {
+		s->largeSteps = _buildLargeSteps;
+		s->count = count;
+		s->building = false;
+	}
+
+	XY_List = _segSavedList;
+	XYlistEnd = _segSavedEnd;
+	MaxBuffSize = _segSavedMaxBuffSize;
+	_buildLargeSteps = _segSavedLargeSteps;
+	_segActive = -1;
+	#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		autoSetRefreshTime();	//Set the refresh period for the new frame before it is painted (cost model)
+	#endif
+	return;
+}
+
+void XYscope::segmentClear(int seg) {
+	//	Erase all points of a segment.  The segment keeps its slot, name, pool space, visibility & paint order.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (seg < 0 || seg >= _segCount) return;
+	_seg[seg].count = 0;
+	_seg[seg].largeSteps = 0;
+}
+
+void XYscope::segmentShow(int seg, bool visible) {
+	//	Show (visible=true) or hide (visible=false) a segment.  Its points are kept either way.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (seg < 0 || seg >= _segCount) return;
+	_seg[seg].visible = visible;
+}
+
+void XYscope::segmentMoveTo(int seg, int position) {
+	//	Change the paint order of a segment.  Segments are always painted after the XY_List;
+	//	position 0 is painted first.  Out of range positions are clamped to the end of the order.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int from, k;
+	if (seg < 0 || seg >= _segCount) return;
+	if (position < 0) position = 0;
+	if (position >= _segCount) position = _segCount - 1;
+
+	noInterrupts();
+		for (from = 0; from < _segCount; from++) if (_segOrder[from] == seg) break;
+		if (from < position) {
+			for (k = from; k < position; k++) _segOrder[k] = _segOrder[k + 1];
+		} else {
+			for (k = from; k > position; k--) _segOrder[k] = _segOrder[k - 1];
+		}
+		_segOrder[position] = seg;
+	interrupts();
+}
+
+void XYscope::segmentPriority(int seg, uint8_t priority) {
+	//	Set the Level Of Detail priority of a segment (see setLodRefreshUs).  When the display is too big to paint
+	//	in the LOD refresh period, the highest numbered priorities are thinned out first; priority 0 (the default,
+	//	also used for the XY_List & primitives) is thinned last.  Values above LodLowestPriority are clamped.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (seg < 0 || seg >= _segCount) return;
+	_seg[seg].priority = min(priority, uint8_t(LodLowestPriority));
+}
+
+int XYscope::segmentPoints(int seg) {
+	//	Returns number of points held by a segment (0 if handle is not valid).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (seg < 0 || seg >= _segCount) return 0;
+	return _seg[seg].count;
+}
+
+void XYscope::segmentDeleteAll() {
+	//	Delete every segment and give the whole segment pool back.  Handles from segmentCreate() become invalid.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_segActive >= 0) segmentEnd();
+	segmentWaitPaintIdle();
+		_segCount = 0;
+		_segPoolUsed = 0;
+	interrupts();
+}
+
+void XYscope::spriteBegin(int xOrigin, int yOrigin) {
+	//	Routine to start recording a sprite.  Until spriteEnd() is called, plotPoint, plotLine, plotCircle, print,
+	//	etc. are recorded as the sprite's points, relative to (xOrigin, yOrigin).  Draw the sprite around an origin
+	//	that keeps it all on screen (points off screen are dropped, as always).
+	//
+	//	The points are built at the end of the list (or segment) being built and are taken back out by spriteEnd().
+	//	With a single buffered XY_List they may be painted once where they were drawn, so record sprites before
+	//	the display starts (setup()) or inside a plotStart() ... plotEnd() that redraws the screen anyway.
+	//
+	//	Calling parameters:
+	//		xOrigin, yOrigin	Point of the drawing that spriteStamp() puts at its (x, y)
+	//
+	//	Returns: NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_spriteRecStart >= 0) return;
+	_spriteRecStart = XYlistEnd;
+	_spriteRecX = xOrigin;
+	_spriteRecY = yOrigin;
+	_spriteRecLargeSteps = _buildLargeSteps;
+}
+
+int XYscope::spriteEnd() {
+	//	Routine to finish recording the sprite started by spriteBegin().  Its points are moved out of the list
+	//	into the sprite pool, along with their PIO settling time tags: steps inside a sprite don't change when it
+	//	is moved, so spriteStamp() copies them instead of working them out again.
+	//
+	//	Calling parameters: NONE
+	//
+	//	Returns: Sprite handle (0..CFG_MaxSprites-1) for spriteStamp(), or -1 if no sprite was being recorded,
+	//			 the list filled up while recording, or there is no free sprite slot or pool space.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_spriteRecStart < 0) return -1;
+	int start = _spriteRecStart;
+	int count = XYlistEnd - start;
+	int sprite = -1;
+	if (SpritesOn && _spriteCount < SpriteSlots && _spritePoolUsed + count <= SpritePoolSize && plotRoom() > 0) {
+		sprite = _spriteCount++;
+		spriteInfo *s = &_sprite[sprite];
+		s->start = _spritePoolUsed;
+		s->count = count;
+		s->xOrigin = _spriteRecX;
+		s->yOrigin = _spriteRecY;
+		s->xMin = s->yMin = s->xMax = s->yMax = 0;
+		s->largeSteps = 0;
+		pointList *p = &XY_SpritePool[s->start];
+		for (int i = 0; i < count; i++, p++) {
+			p->X = XY_List[start + i].X & (0xfff | SettleLong_flag);
+			p->Y = XY_List[start + i].Y & 0xfff;
+			if (i == 0) p->X &= ~SettleLong_flag;	//The first point is tagged again from whatever comes before it
+			s->largeSteps += (p->X & SettleLong_flag) != 0;
+			int dX = (p->X & 0xfff) - s->xOrigin, dY = p->Y - s->yOrigin;
+			if (i == 0) {s->xMin = s->xMax = dX; s->yMin = s->yMax = dY;}
+			s->xMin = min(int(s->xMin), dX); s->xMax = max(int(s->xMax), dX);
+			s->yMin = min(int(s->yMin), dY); s->yMax = max(int(s->yMax), dY);
+		}
+		_spritePoolUsed += count;
+	}
+
+	//Take the points back out of the list
+	XYlistEnd = start;
+	_buildLargeSteps = _spriteRecLargeSteps;
+	_spriteRecStart = -1;
+	return sprite;
+}
+
+void XYscope::spriteStamp(int sprite, int x, int y) {
+	//	Routine to plot a sprite with its origin at (x, y).  The sprite's points are moved to (x, y) and added to
+	//	the list in one block: an integer add per coordinate, with the PIO settling time tags copied (only the
+	//	first point is tagged again).  Points that land off screen are dropped as plotPoint does.  Nothing is
+	//	rasterized (no trig or font ROM walks); the points are those recorded, just moved.  With a 2D transform
+	//	on, the moved points are also transformed (spacing between them then scales with the transform).
+	//
+	//	Calling parameters:
+	//		sprite	Sprite handle from spriteEnd()
+	//		x, y	Where the sprite origin goes
+	//
+	//	Returns: NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (sprite < 0 || sprite >= _spriteCount) return;
+	spriteInfo *s = &_sprite[sprite];
+	const pointList *sp = &XY_SpritePool[s->start];
+	int count = s->count;
+	int dX = x - s->xOrigin, dY = y - s->yOrigin;
+	plotErr = 0;
+	screenSaverKick();
+	if (_xfOn) {	//2D transform: each point is moved, then transformed (a rotated or scaled copy of the recorded points)
+		for (int i = 0; i < count; i++) {
+			int X = (sp[i].X & 0xfff) + dX, Y = sp[i].Y + dY;
+			xfPoint(X, Y);
+			appendPoint(X, Y);
+		}
+	} else if (count <= plotRoom() && onScreen(x + s->xMin, y + s->yMin, x + s->xMax, y + s->yMax)) {
+		//Fast path: the whole sprite fits & is on screen; no per-point checks
+		pointList *p = &XY_List[XYlistEnd];
+		for (int i = 0; i < count; i++) {
+			setPoint(p[i], sp[i].X + dX, sp[i].Y + dY);	//(setPoint drops SettleLong_flag with the bits above 0xfff...)
+			p[i].X |= sp[i].X & SettleLong_flag;			//...so copy it back
+		}
+		_buildLargeSteps += s->largeSteps;
+		settleAnnotate(XYlistEnd, XYlistEnd + 1);
+		XYlistEnd += count;
+	} else {
+		for (int i = 0; i < count; i++) appendPoint((sp[i].X & 0xfff) + dX, sp[i].Y + dY);
+	}
+}
+
+int XYscope::spritePoints(int sprite) {
+	//	Returns number of points in a sprite (0 if handle is not valid).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (sprite < 0 || sprite >= _spriteCount) return 0;
+	return _sprite[sprite].count;
+}
+
+void XYscope::spriteDeleteAll() {
+	//	Delete every sprite and give the whole sprite pool back.  Handles from spriteEnd() become invalid.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_spriteRecStart >= 0) spriteEnd();
+	_spriteCount = 0;
+	_spritePoolUsed = 0;
+}
+
+void XYscope::resetTransform() {
+	//	Routine to turn the 2D transform off (identity matrix) and empty the pushTransform() stack.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	_xf.a = 65536; _xf.b = 0; _xf.tx = 0;
+	_xf.c = 0; _xf.d = 65536; _xf.ty = 0;
+	_xfDepth = 0;
+	_xfOn = false;
+}
+
+bool XYscope::pushTransform() {
+	//	Routine to save the current 2D transform, so it can be changed for a part of the drawing and then
+	//	brought back with popTransform().
+	//
+	//	Returns: false (nothing saved) if CFG_TransformStackDepth transforms are already saved.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_xfDepth >= CFG_TransformStackDepth) return false;
+	_xfStack[_xfDepth++] = _xf;
+	return true;
+}
+
+bool XYscope::popTransform() {
+	//	Routine to bring back the 2D transform saved by the last pushTransform().
+	//
+	//	Returns: false (transform unchanged) if no transform is saved.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_xfDepth == 0) return false;
+	_xf = _xfStack[--_xfDepth];
+	xfChanged();
+	return true;
+}
+
+void XYscope::translate(int dx, int dy) {
+	//	Routine to move everything drawn from now on by (dx, dy), in the current transform's coordinates.
+	//	As with rotate() & scale(), the new step is done first: translate(2048, 2048); rotate(30); then turns
+	//	a drawing about (0, 0) and puts (0, 0) at the middle of the screen.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	_xf.tx += int32_t(int64_t(_xf.a) * dx + int64_t(_xf.b) * dy);
+	_xf.ty += int32_t(int64_t(_xf.c) * dx + int64_t(_xf.d) * dy);
+	xfChanged();
+}
+
+void XYscope::rotate(float degrees) {
+	//	Routine to turn everything drawn from now on counter-clockwise about (0, 0) (use a negative angle for
+	//	clockwise).  sin & cos come from the sine table (sinQ15), once per call.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	uint32_t phase = uint32_t(int64_t(degrees / 360.f * 4294967296.f));	//2^32 = full circle
+	int32_t sinA = sinQ15(phase), cosA = sinQ15(phase + 0x40000000UL);
+	sinA = (int64_t(sinA) * 65536 + (sinA < 0 ? -16383 : 16383)) / 32767;	//Q15 (32767 = 1.0) to Q16
+	cosA = (int64_t(cosA) * 65536 + (cosA < 0 ? -16383 : 16383)) / 32767;
+	transform m = _xf;
+	_xf.a = mulQ16(m.a, cosA) + mulQ16(m.b, sinA);
+	_xf.b = mulQ16(m.b, cosA) - mulQ16(m.a, sinA);
+	_xf.c = mulQ16(m.c, cosA) + mulQ16(m.d, sinA);
+	_xf.d = mulQ16(m.d, cosA) - mulQ16(m.c, sinA);
+	xfChanged();
+}
+
+void XYscope::scale(float s) {
+	scale(s, s);
+}
+
+void XYscope::scale(float sx, float sy) {
+	//	Routine to scale everything drawn from now on about (0, 0): X by sx, Y by sy (negative values mirror).
+	//	Point spacing of lines & circles stays as set by the intensity; text grows as if its size were scaled.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int32_t qx = q16(sx), qy = q16(sy);
+	_xf.a = mulQ16(_xf.a, qx);
+	_xf.c = mulQ16(_xf.c, qx);
+	_xf.b = mulQ16(_xf.b, qy);
+	_xf.d = mulQ16(_xf.d, qy);
+	xfChanged();
+}
+
+void XYscope::transformPoint(int &x, int &y) {
+	//	Routine to work out where the current 2D transform puts (x, y); x & y are updated.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_xfOn) xfPoint(x, y);
+}
+
+void XYscope::xfChanged() {
+	_xfOn = !(_xf.a == 65536 && _xf.b == 0 && _xf.c == 0 && _xf.d == 65536 && _xf.tx == 0 && _xf.ty == 0);
+}
+
+int32_t XYscope::q16(float v) {
+	return int32_t(v * 65536.f + (v < 0 ? -.5f : .5f));
+}
+
+int32_t XYscope::mulQ16(int32_t a, int32_t b) {
+	return int32_t((int64_t(a) * b + 32768) >> 16);
+}
+
+void XYscope::segmentWaitPaintIdle(void) {
+	//	Wait until no paint is reading the lists, then return with interrupts DISABLED.
+	//	Caller must call interrupts() when done.  Three paints run in the background and are waited on:
+	//	the DMA paints (DUE, TEENSY CFG_TnsyDmaPaint; _paintActive) and the sliced PIO paint
+	//	(CFG_SlicedPaint; _psActive), which reads the lists a slice at a time across many interrupts.
+	//	The unsliced PIO paint runs to completion inside the refresh interrupt, so for it this returns at once.
+	//	Gives up after a few refresh periods so a stalled refresh can never hang the caller.
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Also wait for a sliced paint in progress
+	//
+	unsigned long waitStartUs = micros();
+	unsigned long waitLimitUs = 4 * ActiveRefreshPeriod_us + 1000;
+	noInterrupts();
+	while ((_paintActive || _psActive) && (micros() - waitStartUs) < waitLimitUs) {
+		interrupts();
+		noInterrupts();
+	}
+}
 
 void XYscope::plotStart() {
 	//	Routine initialized the XY_List butter;  
@@ -269,9 +1148,35 @@ void XYscope::plotStart() {
 	//  20170526 ver 0.1	E.Andrews	Fine tune number of start up pixels..
 	//	20170617 Ver 0.2	E.Andrews	Simplify Routine Call by eliminating need to pass the index pointer
 	//	20180425 Ver 1.0	E.Andrews	Add TEENSY PIO compatibility
-	//
+	//	20261017 Ver 1.1				When double buffered, wait for the refresh routine to release the back buffer
+	//	20261017 Ver 1.2				Never swap under a paint in progress; drop the committed frame instead
+	//
+	if (CFG_DoubleBufferXYlist) {
+		//	The back buffer was being painted until the refresh routine picked up the last committed list.
+		//	Wait (up to a few refresh periods) for that hand-off before over-writing it.
+		unsigned long waitStartUs = micros();
+		unsigned long waitLimitUs = 4 * ActiveRefreshPeriod_us + 1000;
+		while (_commitPending) {
+			if (micros() - waitStartUs > waitLimitUs) {
+				//Refresh routine is not running (timer not yet started, or stalled)...do the swap ourselves, but
+				//only if no paint (sliced or DMA) is still reading the front list.  If one is stuck part way through
+				//a frame, leave it its list & runs: drop the committed frame and build the next one in its buffer.
+				segmentWaitPaintIdle();	//Returns with interrupts disabled
+				if (!_psActive && !_paintActive) {
+					paintListSwap();
+				} else {
+					_commitPending = false;
+					_backIndex = (_backIndex + XYlistBufferCount - 1) % XYlistBufferCount;
+					XY_List = XY_ListPool[_backIndex];
+				}
+				interrupts();
+				break;
+			}
+		}
+	}
 	plotErr = 0;
 	XYlistEnd = 0;	//Reset list pointer to start-of-list
+	_buildLargeSteps = 0;
 	
 	#if defined(__SAM3X8E__)
 		//----------------------------------------------------    
@@ -302,6 +1207,7 @@ void XYscope::plotStart() {
 		XY_List[XYlistEnd].X = 0 | X_flag;			    //Load X Value
 		XY_List[XYlistEnd].Y = 0 | Y_flag;
 		XYlistEnd++;	//Load Y value and bump pointer
+		settleAnnotate(0, XYlistEnd);	//Tag the sync pulse steps for PIO refresh
 	#endif
 	
 	#if defined(__MK66FX1M0__)	//Only compile this code block for TEENSY 3.6
@@ -315,6 +1221,69 @@ void XYscope::plotStart() {
 	return;
 }
 
+inline void XYscope::screenSaverKick(void) {
+	if (_screenOnTime_ms != 0) _crtOffTOD_ms = millis() + _screenOnTime_ms;//Update ScreenOff time of day (ms)	
+}
+
+inline int XYscope::plotRoom(void) {
+	return (MaxBuffSize - 2) - XYlistEnd;	//plotPoint stops adding points once XYlistEnd > MaxBuffSize-3
+}
+
+inline bool XYscope::onScreen(int xMin, int yMin, int xMax, int yMax) {
+	//true when every point inside the box is plotted as-is (so per-point screen wrap checks can be skipped)
+	return !PreventScreenWrap || (((xMin | yMin | xMax | yMax) & ~0xfff) == 0);
+}
+
+inline void XYscope::appendPoint(int x0, int y0) {
+	if ( ( ( (x0 & ~0xfff)!=0)|| ((y0 & ~0xfff)!=0) ) && PreventScreenWrap) return;
+
+	if (XYlistEnd > MaxBuffSize - 3) {
+		plotErr = 0;//Set plotErr and skip writing point into buffer if we are about to hit the end-of-buffer.
+	} else {
+		setPoint(XY_List[XYlistEnd], x0, y0);	//Load X & Y values (and DUE routing flags)
+		settleAnnotate(XYlistEnd, XYlistEnd + 1);	//Tag it if it is a Large Step from the point before it
+		XYlistEnd++;							//Increment List Pointer  value 
+	}
+}
+
+inline void XYscope::xfPoint(int &x, int &y) {
+	int64_t X = int64_t(_xf.a) * x + int64_t(_xf.b) * y + _xf.tx + 32768;	//(+ 1/2 to round)
+	int64_t Y = int64_t(_xf.c) * x + int64_t(_xf.d) * y + _xf.ty + 32768;
+	x = int(X >> 16);
+	y = int(Y >> 16);
+}
+
+void XYscope::settleAnnotate(int first, int end) {
+	//	Works out the PIO settling time class of each point once, as it is plotted, so that the refresh loop
+	//	(initiatePioScreenPaint/initiateDuePioScreenPaint) only has to test SettleLong_flag instead of doing
+	//	the step size math for every point on every refresh.
+	//
+	//	A point gets SettleLong_flag when its biggest X or Y change from the point before it (in the same
+	//	list or segment) is more than NoSettlingTimeReqd.  The first point of a list or segment is skipped;
+	//	the refresh loop works that one out itself since it follows whatever was painted before it.
+	//
+	//	Calling parameters:
+	//		first, end	Range of XY_List points (end not included) that were just written with setPoint()
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Also clears the flag, so points moved by the beam path optimizer can be tagged again
+	//	20261017 Ver 0.2	Keeps _buildLargeSteps (Large Steps in the list being built) for the paint time cost model
+	//
+	if (first < 1) first = 1;
+	for (pointList *p = &XY_List[first]; first < end; first++, p++) {
+		int dX = abs((p->X & 0xfff) - (p[-1].X & 0xfff));
+		int dY = abs((p->Y & 0xfff) - (p[-1].Y & 0xfff));
+		bool wasLong = p->X & SettleLong_flag;
+		if (max(dX, dY) > NoSettlingTimeReqd) {
+			p->X |= SettleLong_flag;
+			_buildLargeSteps += !wasLong;
+		} else {
+			p->X &= ~SettleLong_flag;
+			_buildLargeSteps -= wasLong;
+		}
+	}
+}
+
 void XYscope::plotPoint(int x0, int y0) {
 	//	Routine for POINT plotting
 	//	Calling parameters:
@@ -330,40 +1299,48 @@ void XYscope::plotPoint(int x0, int y0) {
 	//	20170627 Ver 0.2	E.Andrews	Simplify Routine Call by eliminating need to pass the index pointer
 	//	20180425 Ver 1.0	E.Andrews	Add TEENSY PIO compatibility
 	//	20180611 Ver 1.1	E.Andrews	Add 'PreventScreenWrap' protection Option.
-	//
-	
-	if (_screenOnTime_ms != 0) _crtOffTOD_ms = millis() + _screenOnTime_ms;//Update ScreenOff time of day (ms)	
-	
-	if ( ( ( (x0 & 0xf000)!=0)|| ((y0 & 0xf000)!=0) ) && PreventScreenWrap) return;
+	//	20261017 Ver 1.2				Body moved to appendPoint() & setPoint() so the rasterizers can share it
+	//	20261017 Ver 1.3				2D transform (translate, rotate, scale)
+	//	20261017 Ver 1.4				Screen wrap check tests every bit above bit 11 (coordinates 65536 or more off
+	//									screen used to slip through & fold over)
+	//
+	if (_xfOn) xfPoint(x0, y0);
+	screenSaverKick();
+	appendPoint(x0, y0);
+	return;
+}
 
-	#if defined(__SAM3X8E__)
-		//----------------------------------------------------    
-		//  DUE CODE BLOCK
-		//----------------------------------------------------	
-		//
+XYscope::pointList *XYscope::plotReserve(int &count) {
+	//	Span append, step 1: reserves room for a block of points at the end of XY_List (or of the segment being built).
+	//	Fill the block with setPoint(), then call plotAppend() to add them to the list.
+	//
+	//	Calling parameters:
+	//		count	Number of points wanted.  Trimmed (returned) to the number that will fit; 0 if the list is full.
+	//
+	//	Returns: Pointer to the first reserved point.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int room = plotRoom();
+	if (count > room) count = room;
+	if (count < 0) count = 0;
+	return &XY_List[XYlistEnd];
+}
 
-		if (XYlistEnd > MaxBuffSize - 3) {
-			plotErr = 0;//Set plotErr and skip writing point into buffer if we are about to hit the end-of-buffer.
-		} else {
-			XY_List[XYlistEnd].X = (x0 & 0xfff) | X_flag;//Load X Value into EVEN array term
-			XY_List[XYlistEnd].Y = (y0 & 0xfff) | Y_flag;//Load Y value into ODD array term
-			XYlistEnd++;							//Increment List Pointer  value 
-		}
-	#endif	
-	
-	#if defined(__MK66FX1M0__)	//Only compile this code block for TEENSY 3.6
-		//----------------------------------------------------    
-		//  TEENSY 3.6  CODE BLOCK
-		//----------------------------------------------------
-		if (XYlistEnd > MaxBuffSize - 3) {
-			plotErr = 0;//Set plotErr and skip writing point into buffer if we are about to hit the end-of-buffer.
-		} else {
-			XY_List[XYlistEnd].X = (x0 & 0xfff);	//Load X Value into EVEN array term
-			XY_List[XYlistEnd].Y = (y0 & 0xfff);	//Load Y value into ODD array term
-			XYlistEnd++;							//Increment List Pointer  value 
-		}		
-	#endif
-	return;
+void XYscope::plotAppend(int count) {
+	//	Span append, step 2: adds the first 'count' points written after plotReserve() to the list.
+	//	The screen saver time-out is pushed back once for the whole block, and the block is tagged for
+	//	PIO settling time (settleAnnotate) in one pass.
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Tag the block for PIO settling time
+	//
+	int room = plotRoom();
+	if (count > room) count = room;
+	if (count <= 0) return;
+	screenSaverKick();
+	settleAnnotate(XYlistEnd, XYlistEnd + count);
+	XYlistEnd += count;
 }
 
 void XYscope::plotLine(int x0, int y0, int x1, int y1) {
@@ -385,42 +1362,32 @@ void XYscope::plotLine(int x0, int y0, int x1, int y1) {
 	//
 	//	20170321 Ver 0.1	E.Andrews	First cut
 	//	20170617 Ver 0.2	E.Andrews	Simplify Routine Call by eliminating need to pass the index pointer
+	//	20261017 Ver 0.3				Steps straight from one plotted point to the next (lineStepper) instead of
+	//									running Bresenham over every DAC count and skipping _graphDensity of them
+	//	20261017 Ver 0.4				Screen saver, end-of-buffer & screen wrap checks done once per line when possible
+	//	20261017 Ver 0.5				Fast path tags PIO settling time for the whole line in one pass (settleAnnotate)
+	//	20261017 Ver 0.6				2D transform: the end points are transformed, so point spacing is kept
+	//	20261017 Ver 0.7				Lines running off screen are clipped (lineStepClip); off-screen points are never visited
 	//
 	plotErr = 0;
-	//int lastPointX, lastPointY;
-	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
-	int dy = abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
-	
-
-	int err = (dx > dy ? dx : -dy) / 2, e2;
-	int SkipCount = 0;
-	for (;;) {
-		if (SkipCount <= 0)	//|| (x0 == x1 && y0 == y1) )	//should we actually plot this point to the screen?
-		{	//YES, plot the point
-			plotPoint(x0, y0);
-			//lastPointX = x0;		//Save and hold the last point plotted
-			//lastPointY = y0;
-			SkipCount = _graphDensity;
-		} else { //NO, skip this point
-			SkipCount--;	//The point is to be skipped so we don't need to actually send the point to the screen buffer
-							//Just decrement Skip Point Counter till it gets to Zero, then plot the point
-		}
-
-		if (x0 == x1 && y0 == y1) {
-			//COMMENTED OUT to eliminate 'bright dots' in the characters due to endpoint overlap of each of the vectors
-			//Force a plot at the endpoint to 'finish the line' if the end point was not previously plotted
-			//if (lastPointX != x1 && lastPointY != y1) plotPoint(x1, y1);
-			break;
-		}
-		e2 = err;
-		if (e2 > -dx) {
-			err -= dy;
-			x0 += sx;
-		}
-		if (e2 < dy) {
-			err += dx;
-			y0 += sy;
-		}
+	if (_xfOn) {
+		xfPoint(x0, y0);
+		xfPoint(x1, y1);
+	}
+	lineStepper ls;
+	int X, Y;
+	lineStepStart(ls, x0, y0, x1, y1, _graphDensity);
+	if (!onScreen(min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1))) lineStepClip(ls);	//Keep just the on-screen run
+	screenSaverKick();
+	if (ls.count <= plotRoom()) {
+		//Fast path: whole (clipped) line fits; no per-point checks
+		pointList *p = &XY_List[XYlistEnd];
+		int n = ls.count;
+		while (lineStepNext(ls, X, Y)) setPoint(*p++, X, Y);	//Only the points that are actually plotted are visited
+		settleAnnotate(XYlistEnd, XYlistEnd + n);
+		XYlistEnd += n;
+	} else {
+		while (lineStepNext(ls, X, Y)) appendPoint(X, Y);
 	}
 
 	return;
@@ -644,55 +1611,9 @@ void XYscope::plotCircle(int xc, int yc, int r, uint8_t arcSegment) {
 	//	20170907 Ver 2.0 	E.Andrews	Abandon Bresenham algorithm for slower floating point approach
 	//									because new approach plots adjacent points and does not take advantage
 	//									of figure symetry.This Allows AGI to run at a higher DMA_CLK freq.
+	//	20261017 Ver 3.0				Same point spacing, now integer/sine-table based (plotArcPoints); only enabled segments are visited
 	//
-	const float pi = atan(1) * 4;
-	//const float arcAng0 = 0;			//reserved but unused constant
-	const float arcAng1 = pi * .25;		// .25 * pi
-	const float arcAng2 = pi * .5;		// .50 * pi
-	const float arcAng3 = pi * .75;		// .75 * pi
-	const float arcAng4 = pi;			//1.00 * pi
-	const float arcAng5 = pi * 1.25;	//1.25 * pi
-	const float arcAng6 = pi * 1.50;	//1.50 * pi
-	const float arcAng7 = pi * 1.75;	//1.75 * pi
-	const float FullCircle = 2 * pi;	//2.00 * pi
-	float circumf;
-	short xr, yr;
-	xr = yr = r;
-
-	//calculate circle circumference
-	circumf = FullCircle * r;
-
-	//Figure out how many points we will actually be plotting
-	//based on the current graphicsIntensity (_graphicsDensity) setting
-	float numOfPoints = circumf / _graphDensity;
-	//Calc the deltaAng between points
-	float deltaAng = FullCircle / (numOfPoints);
-
-	float angle;
-	short X, Y;
-
-	for (angle = 0; angle < FullCircle; angle = angle + deltaAng) {
-		X = int(xc - cos(angle) * xr);
-		Y = int(yc + sin(angle) * yr);
-
-		//Only plot those segments that are enabled by passed "arcSegment" variable
-		if (arcSegment & arc0 && angle <= arcAng1)
-			plotPoint(X, Y);					//Segment 0
-		if (arcSegment & arc1 && angle > arcAng1 && angle <= arcAng2)
-			plotPoint(X, Y);	//Segment 1
-		if (arcSegment & arc2 && angle > arcAng2 && angle <= arcAng3)
-			plotPoint(X, Y);	//Segment 2
-		if (arcSegment & arc3 && angle > arcAng3 && angle <= arcAng4)
-			plotPoint(X, Y);	//Segment 3
-		if (arcSegment & arc4 && angle > arcAng4 && angle <= arcAng5)
-			plotPoint(X, Y);	//Segment 4
-		if (arcSegment & arc5 && angle > arcAng5 && angle <= arcAng6)
-			plotPoint(X, Y);	//Segment 5
-		if (arcSegment & arc6 && angle > arcAng6 && angle <= arcAng7)
-			plotPoint(X, Y);	//Segment 6
-		if (arcSegment & arc7 && angle > arcAng7)
-			plotPoint(X, Y);	//Segment 7
-	}
+	plotArcPoints(xc, yc, r, r, arcSegment);
 
 	return;
 }
@@ -1036,6 +1957,173 @@ void XYscope::plotEllipseBres(int xc, int yc, int xr, int yr, uint8_t arcSegment
 	return;
 }
 */
+uint32_t XYscope::arcPhaseStep(int xr, int yr) {
+	//	Works out the angle step between plotted points of a circle or ellipse as a 32-bit phase (2^32 = full circle).
+	//	Points are spaced the same as the original floating point plotEllipse(): numOfPoints = circumference / _graphDensity.
+	//	This is the only floating point math done per figure; plotArcPoints() & the primitive stepper then use integers only.
+	//
+	//	Calling parameters:
+	//		xr, yr	X-Radius, Y-Radius
+	//
+	//	Returns: phase step, 1 to 2^32-1
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	const float FullCircle = 6.2831853;	//2 * pi
+	float circumf = FullCircle * sqrt((float(xr) * xr + float(yr) * yr) / 2.);
+	float step = 4294967296. * max(_graphDensity, 1) / max(circumf, 1.f);	//2^32 / numOfPoints
+	if (step >= 4294967296.f) return 0xffffffffUL;	//(4294967295 isn't a float; converting 2^32 would overflow)
+	if (step < 1.) step = 1.;
+	return uint32_t(step);
+}
+
+static const uint64_t FullPhase = 0x100000000ULL;	//2^32 = full circle
+
+static int arcRangesMerge(uint64_t r[][2], int n) {
+	//	Sorts phase ranges [start, end) by start & merges those that overlap or touch.  Returns the new count.
+	for (int i = 1; i < n; i++)
+		for (int j = i; j > 0 && r[j][0] < r[j - 1][0]; j--) {
+			uint64_t s = r[j][0], e = r[j][1];
+			r[j][0] = r[j - 1][0]; r[j][1] = r[j - 1][1];
+			r[j - 1][0] = s; r[j - 1][1] = e;
+		}
+	int m = 0;
+	for (int i = 0; i < n; i++) {
+		if (r[i][1] <= r[i][0]) continue;
+		if (m > 0 && r[i][0] <= r[m - 1][1]) r[m - 1][1] = max(r[m - 1][1], r[i][1]);
+		else {r[m][0] = r[i][0]; r[m][1] = r[i][1]; m++;}
+	}
+	return m;
+}
+
+static int arcAxisRanges(float c, float a, float b, uint64_t r[4][2]) {
+	//	Phase ranges of an arc where one axis, c + a*cos(angle) + b*sin(angle), can be on screen (0 to 4095).
+	//	Widened by a few counts & phase steps so that no point the sine table steppers put on screen is lost.
+	//	Returns the number of sorted, separate ranges (0 to 2); one range of [0, 2^32) when always on screen.
+	const float TwoPi = 6.2831853;
+	float amp = sqrt(a * a + b * b);	//c + amp * cos(angle - lag)
+	float pad = 2 + amp / 1024;
+	float cLo = (-pad - c) / max(amp, 1e-3f), cHi = (4095 + pad - c) / max(amp, 1e-3f);	//cos(angle - lag) range that is on screen
+	if (cLo > 1 || cHi < -1) return 0;
+	if (cLo <= -1 && cHi >= 1) {
+		r[0][0] = 0;
+		r[0][1] = FullPhase;
+		return 1;
+	}
+	float t1 = acos(min(cHi, 1.f)), t2 = acos(max(cLo, -1.f));	//On screen for angle - lag = t1 to t2 and -t2 to -t1
+	float lag = atan2(b, a);
+	const float PhasePad = 4096;	//Covers float rounding of the phase (2^32 in a float is good to 2^8)
+	int n = 0;
+	for (int side = 0; side < 2; side++) {
+		float from = side == 0 ? lag + t1 : lag - t2;
+		int64_t start = int64_t(floor(from / TwoPi * 4294967296.f - PhasePad));
+		uint64_t width = uint64_t((t2 - t1) / TwoPi * 4294967296.f + 2 * PhasePad);
+		start = ((start % int64_t(FullPhase)) + int64_t(FullPhase)) % int64_t(FullPhase);	//0 to 2^32-1
+		if (width >= FullPhase) width = FullPhase;
+		r[n][0] = uint64_t(start);
+		r[n][1] = min(uint64_t(start) + width, FullPhase);
+		n++;
+		if (uint64_t(start) + width > FullPhase) {	//Wraps past a full turn
+			r[n][0] = 0;
+			r[n][1] = uint64_t(start) + width - FullPhase;
+			n++;
+		}
+	}
+	return arcRangesMerge(r, n);
+}
+
+void XYscope::plotArcPoints(int xc, int yc, int xr, int yr, uint8_t arcSegment) {
+	//	Integer circle/ellipse rasterizer used by plotCircle() & plotEllipse().
+	//	Steps a 32-bit phase accumulator (2^32 = full circle) and looks up sin/cos in the quarter-wave sine table.
+	//	The top 3 bits of the phase are the arc segment number, so each enabled segment is visited on its own
+	//	and disabled segments cost nothing.  Point positions match the primitive ellipse stepper (primNextPoint).
+	//	Screen saver, end-of-buffer & screen wrap checks are done once per figure when the whole figure fits.
+	//
+	//	Calling parameters:	Same as plotEllipse()
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Fast path tags PIO settling time for the whole figure in one pass (settleAnnotate)
+	//	20261017 Ver 0.2	2D transform: points are worked out on the transformed figure (Q16), spaced for its size
+	//	20261017 Ver 0.3	Figures running off screen are clipped to the phase ranges that can be on screen
+	//						(arcAxisRanges); points in the rest of the figure are never worked out
+	//
+	int64_t uX = 0, uY = 0, vX = 0, vY = 0, cX = 0, cY = 0;	//Transformed: X axis & Y axis radius vectors, center (Q16)
+	bool xf = _xfOn && !(_xf.a == 65536 && _xf.b == 0 && _xf.c == 0 && _xf.d == 65536);
+	if (_xfOn && !xf) xfPoint(xc, yc);	//Just moved: same points as plotting at the moved center
+	int boxX = abs(xr), boxY = abs(yr);
+	if (xf) {
+		uX = int64_t(_xf.a) * xr; uY = int64_t(_xf.c) * xr;
+		vX = int64_t(_xf.b) * yr; vY = int64_t(_xf.d) * yr;
+		cX = int64_t(_xf.a) * xc + int64_t(_xf.b) * yc + _xf.tx + 32768;	//(+ 1/2 so the >> 16 below rounds)
+		cY = int64_t(_xf.c) * xc + int64_t(_xf.d) * yc + _xf.ty + 32768;
+		boxX = int((llabs(uX) + llabs(vX)) >> 16) + 1;
+		boxY = int((llabs(uY) + llabs(vY)) >> 16) + 1;
+		xc = int(cX >> 16);
+		yc = int(cY >> 16);
+		xr = int(sqrt(float(uX) * uX + float(uY) * uY) / 65536.);	//Conjugate radii: their squares add up to those of the
+		yr = int(sqrt(float(vX) * vX + float(vY) * vY) / 65536.);	//transformed ellipse's own radii, so arcPhaseStep fits
+	}
+	uint32_t step = arcPhaseStep(xr, yr);
+	uint64_t phase = 0;
+	int first = XYlistEnd;
+	screenSaverKick();
+	uint64_t vis[16][2];	//Phase ranges [start, end) to visit
+	vis[0][0] = 0;
+	vis[0][1] = FullPhase;
+	int visCount = 1;
+	bool whole = onScreen(xc - boxX, yc - boxY, xc + boxX, yc + boxY);
+	if (!whole) {	//Part (or all) of the figure is off screen: visit only the phase ranges that can be on screen
+		if (xc + boxX < 0 || xc - boxX > 4095 || yc + boxY < 0 || yc - boxY > 4095) return;
+		uint64_t xVis[4][2], yVis[4][2];
+		int xCount, yCount;
+		if (xf) {
+			xCount = arcAxisRanges(cX / 65536.f, -uX / 65536.f, vX / 65536.f, xVis);
+			yCount = arcAxisRanges(cY / 65536.f, -uY / 65536.f, vY / 65536.f, yVis);
+		} else {
+			xCount = arcAxisRanges(xc, -xr, 0, xVis);
+			yCount = arcAxisRanges(yc, 0, yr, yVis);
+		}
+		visCount = 0;
+		for (int i = 0; i < xCount; i++)	//On screen in X AND in Y
+			for (int j = 0; j < yCount; j++) {
+				vis[visCount][0] = max(xVis[i][0], yVis[j][0]);
+				vis[visCount][1] = min(xVis[i][1], yVis[j][1]);
+				visCount++;
+			}
+		visCount = arcRangesMerge(vis, visCount);
+	}
+	//Fast path (no per-point checks) if the whole figure is on screen & every point of a full revolution fits
+	bool fast = whole && (0xffffffffUL / step + 1) <= uint32_t(max(plotRoom(), 0));
+	for (uint8_t seg = 0; seg < 8; seg++) {
+		if ((arcSegment & (1 << seg)) == 0) continue;	//Skip disabled arc segments entirely
+		uint32_t segStart = uint32_t(seg) << 29;
+		uint64_t segEnd = uint64_t(segStart) + 0x20000000UL;
+		for (int r = 0; r < visCount; r++) {
+			uint64_t from = max(uint64_t(segStart), vis[r][0]), to = min(segEnd, vis[r][1]);
+			if (from >= to) continue;
+			if (phase < from) {	//Jumped over disabled segment(s) or a clipped range; find first point at or after its start
+				phase = uint64_t(uint32_t(from) / step) * step;
+				if (phase < from) phase += step;
+			}
+			for (; phase < to; phase += step) {
+				uint32_t angle = uint32_t(phase);
+				int X, Y;
+				if (xf) {	//Center - cos(angle) * u + sin(angle) * v
+					int32_t cosA = sinQ15(angle + 0x40000000UL), sinA = sinQ15(angle);
+					X = int((cX + ((vX * sinA - uX * cosA) >> 15)) >> 16);
+					Y = int((cY + ((vY * sinA - uY * cosA) >> 15)) >> 16);
+				} else {
+					X = xc - ((xr * sinQ15(angle + 0x40000000UL) + 16384) >> 15);	//X = xc - cos(angle) * xr
+					Y = yc + ((yr * sinQ15(angle) + 16384) >> 15);					//Y = yc + sin(angle) * yr
+				}
+				if (fast) setPoint(XY_List[XYlistEnd++], X, Y);
+				else appendPoint(X, Y);
+			}
+		}
+	}
+	if (fast) settleAnnotate(first, XYlistEnd);
+}
+
 void XYscope::plotEllipse(int xc, int yc, int xr, int yr) {plotEllipse(xc,yc,xr,yr, 255); }
 void XYscope::plotEllipse(int xc, int yc, int xr, int yr, uint8_t arcSegment) {
 	//	Routine for ELLIPSE plotting.  Basic algorithm implementation/starting code base from: 
@@ -1079,51 +2167,9 @@ void XYscope::plotEllipse(int xc, int yc, int xr, int yr, uint8_t arcSegment) {
 	//	20170907	Ver 2.0 E.Andrews	Abandon Bresenham algorithm for slower floating point approach
 	//									because new approach plots adjacent points and does not take advantage
 	//									of figure symmetry. This Allows AGI to produce nice graphics even a higher DMA_CLK frequencies.
-	const float pi = atan(1) * 4;
-	//const float arcAng0 = 0;			//reserved but unused constant
-	const float arcAng1 = pi * .25;		// .25 * pi
-	const float arcAng2 = pi * .5;		// .50 * pi
-	const float arcAng3 = pi * .75;		// .75 * pi
-	const float arcAng4 = pi;			//1.00 * pi
-	const float arcAng5 = pi * 1.25;	//1.25 * pi
-	const float arcAng6 = pi * 1.50;	//1.50 * pi
-	const float arcAng7 = pi * 1.75;	//1.75 * pi
-	const float FullCircle = 2 * pi;	//2.00 * pi
-	float circumf;
-	//calculate ellipse circumference
-
-	circumf = FullCircle * sqrt((pow(xr, 2) + pow(yr, 2)) / 2.);
-	//Figure out how many points we will actually be plotting
-	//based on the current graphicsIntensity (_graphicsDensity) setting
-	float numOfPoints = circumf / _graphDensity;
-	//Calc the deltaAng between points
-	float deltaAng = FullCircle / (numOfPoints);
-
-	float angle;
-	short X, Y;
-
-	for (angle = 0; angle < FullCircle; angle = angle + deltaAng) {
-		X = int(xc - cos(angle) * xr);
-		Y = int(yc + sin(angle) * yr);
-
-		//Only plot those segments that are enabled by passed "arcSegment" variable
-		if (arcSegment & arc0 && angle <= arcAng1)
-			plotPoint(X, Y);					//Segment 0
-		if (arcSegment & arc1 && angle > arcAng1 && angle <= arcAng2)
-			plotPoint(X, Y);	//Segment 1
-		if (arcSegment & arc2 && angle > arcAng2 && angle <= arcAng3)
-			plotPoint(X, Y);	//Segment 2
-		if (arcSegment & arc3 && angle > arcAng3 && angle <= arcAng4)
-			plotPoint(X, Y);	//Segment 3
-		if (arcSegment & arc4 && angle > arcAng4 && angle <= arcAng5)
-			plotPoint(X, Y);	//Segment 4
-		if (arcSegment & arc5 && angle > arcAng5 && angle <= arcAng6)
-			plotPoint(X, Y);	//Segment 5
-		if (arcSegment & arc6 && angle > arcAng6 && angle <= arcAng7)
-			plotPoint(X, Y);	//Segment 6
-		if (arcSegment & arc7 && angle > arcAng7)
-			plotPoint(X, Y);						//Segment 7
-	}
+	//	20261017	Ver 3.0					Same point spacing, now integer/sine-table based (plotArcPoints); only enabled segments are visited
+	//
+	plotArcPoints(xc, yc, xr, yr, arcSegment);
 }
 /*
 
@@ -1397,6 +2443,11 @@ short XYscope::getActiveFont(){
 		
 		
 void XYscope::plotChar(char c, int& charX, int& charY, int& charHt) {
+	//	Plots one character in the active font (plotChar_V or plotChar_H) and moves charX, charY on.
+	//
+	//	20261017 Ver 0.1	Characters come from the glyph cache when they can (glyphCachePlot)
+	//
+	if (glyphCachePlot(c, charX, charY, charHt)) return;
 	if(ActiveFont==_VectorFont) plotChar_V(c, charX, charY, charHt);
 	if(ActiveFont==_HersheyFont) plotChar_H(c, charX, charY, charHt);
 }
@@ -1428,6 +2479,8 @@ void XYscope::plotChar(char c, int& charX, int& charY, int& charHt) {
 		//
 		//	20180504 Ver 0.0	E.Andrews	First cut
 		//	20180507 Ver 1.0	E.Andrews	Initial release for external testing	
+		//	20261017 Ver 1.1				Cell size & centering moved to hersheyCharLayout() (shared with primChar)
+		//	20261017 Ver 1.2				Walks the packed HersheyVertexStream[] (no padding, single-byte pen-up)
 		//
 		
 		plotErr = 0;
@@ -1435,142 +2488,108 @@ void XYscope::plotChar(char c, int& charX, int& charY, int& charHt) {
 		#if CFG_IncludeHersheyFontROM == true	//BEGIN DO NOT COMPILE if CFG_IncludeHersheyFontROM == false
 		
 		{
+			float charScale;
+			int xStartOffset, charWidth;
+			if (!hersheyCharLayout(c, charHt, charScale, xStartOffset, charWidth)) {
+				plotErr = 1;	//Undefined character is being ignored
+				return;
+			}
+
 			//For Character Plotting, temporarily set  _density value to _textDensity
 			short tempDensity = _graphDensity;
 			_graphDensity = _textDensity;	
 			
-			bool forceMonospacing=true;
-			if(c < 45 || c > 57) forceMonospacing=false;	//set flag to force mono spacing for Neg_sign, numbers, decimal point		
-			
-			if(c < 32 || c > 126) //ensure that character is in table and handle errors per CONFIGURATION file setting
-			{
-				if(CFG_IgnoreUndefinedCharacters){	//Ignore
-					//Serial.println("err");
-					plotErr = 1;
-					return;
-				}
-		
-				else {
-					c='~';	//Set to squiggly if out of range	
-				}
-			}
-			
-			//Since HersheyFontROM is not a structure, access to each data element is awkward at best...
-			int index = c - 32;	//Create pointer into HersheyROM		
-			
-			int numVerticies = HersheyFontROM[index][0];			//Extract how many verticies are in this character...
+			int index = c - 32;	//Create pointer into HersheyGlyphIndex[]
+			const int8_t *v = &HersheyVertexStream[HersheyGlyphIndex[index].Offset];	//First vertex of this character
+			const int8_t *vEnd = v + HersheyGlyphIndex[index].Length;
 			int HersheyCharHt= HersheycharHt;						//Adjust Char Height
-			float Hershry_Y_Offset=int(float(HersheycharHt)/3.);	//The Hershey ROM is biased up by about 1/2 a character cell...
-			int HersheyCharCellRight=0;								//Right most X-coord of verticies within the current character
-			int HersheyCharCellLeft=0;								//Left mos X-coord of verticies within the current character
-			//float hScale = float(h) / float(charHeight); // scale factor
-			float charScale = float(charHt)/float(HersheyCharHt); // scale factor
+			float Hershry_Y_Offset=HersheyBaselineOffset;			//The Hershey ROM is biased up by about 1/2 a character cell...
 			
 			//========================================================================
-			//quickly scan through the character to get size and centering parameters set
+			//Now walk the verticies and plot the lines as defined in the ROM
 			//========================================================================
-			for(int i = 0; i < numVerticies; i++){ //iterate over verticies
-			
-				//check (X0,y0) & (x1,y1) coordinates; if any of the verticies == -1 then it's a 'penUp', no-plot entry 
-				bool penUp = false;
-				if( (HersheyFontROM[index][2*(i+1)+0] == -1)&& (HersheyFontROM[index][2*(i+1)+1] == -1))penUp=true;
-				if( (HersheyFontROM[index][2*(i+1)+2] == -1)&& (HersheyFontROM[index][2*(i+1)+3] == -1))penUp=true;
-				/*
-					for(int j = 0; j < 3; j++){
-						if(HersheyFontROM[index][2*(i+1)+j] == -1){	//'-1' means that we are ending a vector and starting a new one
-							penUp = true;
-						}
-					}
-				*/
-				if(!penUp)
-				{
-
-					if (HersheyCharCellRight < HersheyFontROM[index][2*(i+1)+0] ) HersheyCharCellRight=HersheyFontROM[index][2*(i+1)+0];	//Find the largest X-coordinate
-					if (HersheyCharCellRight < HersheyFontROM[index][2*(i+1)+2] ) HersheyCharCellRight=HersheyFontROM[index][2*(i+1)+2];	//Find the largest X-coordinate
-					
-					if (HersheyCharCellLeft > HersheyFontROM[index][2*(i+1)+0] ) HersheyCharCellLeft=HersheyFontROM[index][2*(i+1)+0];	//Find the smallest X-coordinate
-					if (HersheyCharCellLeft > HersheyFontROM[index][2*(i+1)+2] ) HersheyCharCellLeft=HersheyFontROM[index][2*(i+1)+2];	//Find the smallest X-coordinate
-				} 
-			}				
-			
-			int charWidth;
-			charWidth = int(float(_fontSpacing)*2.3);	//This is the default width for MONO spaced characters
-			//TODO Serial.print(" plotChar -");
-			
-			//Spacing constants...prop = 0, monoTight = 8, mono = 10, monoNorm = 10, monoWide = 12;//Define FontSpacing  Constants
-			
-			int xStartOffset=0;
-			if (_fontSpacing == prop ) {	//Are we running in a Proportional Spacing Mode?
-				charWidth = HersheyCharCellRight-HersheyCharCellLeft+4;	//Get the exact cell size for the current character
-				//if (charWidth==4) charWidth=8;
-				//if (c==' ')charWidth =10;	//'Space'
-				//TODO Serial.print(c); Serial.print(", width = ");Serial.print(charWidth);
-				if(charWidth<8) charWidth=8;	//This defines minimum char spacing
-			}
-			if (forceMonospacing) {
-				charWidth = int(float(mono)*2.3);
-			
-			}
-			//This is Left-Right Self-centering the current character code....
-			xStartOffset =int(float(charWidth - (HersheyCharCellRight-HersheyCharCellLeft))/2. +.5);//- HersheyCharCellLeft;
-			/*	
-				if(c=='Q'||c=='{'||c=='|'){
-					Serial.print("DIAG - Char= ");Serial.print(c);Serial.print(" _fontSpacing=");Serial.print(_fontSpacing);Serial.print(" charWidth=");Serial.print(charWidth);Serial.print(" CellRight=");Serial.print(HersheyCharCellRight);
-					Serial.print(" CellLeft=");Serial.print(HersheyCharCellLeft);Serial.print(" xOffset=");Serial.print(xStartOffset);
-					Serial.println();
+			bool penDown = false;	//false = no previous vertex to draw from (start of character or after a HersheyPenUp)
+			int px = 0, py = 0;
+			while (v < vEnd) {
+				if (*v == HersheyPenUp) {	//'penUp', no-plot entry
+					penDown = false;
+					v++;
+					continue;
 				}
-			*/
-			
-			//========================================================================
-			//Now scan through the verticies and plot the lines as defined in the ROM
-			//========================================================================
-			for(int i = 0; i < numVerticies; i++){ //iterate over verticies
-			
-				//check (X0,y0) & (x1,y1) coordinates; if any of the verticies == -1 then it's a 'penUp', no-plot entry 
-				bool penUp = false;
-				if( (HersheyFontROM[index][2*(i+1)+0] == -1)&& (HersheyFontROM[index][2*(i+1)+1] == -1))penUp=true;
-				if( (HersheyFontROM[index][2*(i+1)+2] == -1)&& (HersheyFontROM[index][2*(i+1)+3] == -1))penUp=true;
-
-				/*
-					for(int j = 0; j < 3; j++){
-						if(HersheyFontROM[index][2*(i+1)+j] == -1){	//'-1' means that we are ending a vector and starting a new one
-						
-							penUp = true;
-						}
-					}
-				*/
-				if(!penUp)
+				int vx = v[0], vy = v[1];
+				v += 2;
+				if (penDown)
 				{
-					//drawline(x + HersheyFontROM[index][2*(i+1)+0]*h, y + HersheyFontROM[index][2*(i+1)+1]*h, x + HersheyFontROM[index][2*(i+1)+2]*h, y + HersheyFontROM[index][2*(i+1)+3]*h);
-
-					int x0 = charX + int(float(HersheyFontROM[index][2*(i+1)+0])*charScale+.5)+xStartOffset*charScale;
-					int y0 = charY + int( (float(HersheyFontROM[index][2*(i+1)+1])+Hershry_Y_Offset)*charScale+.5);
-					int x1 = charX + int(float(HersheyFontROM[index][2*(i+1)+2])*charScale+.5) + xStartOffset*charScale;
-					int y1 = charY + int( (float(HersheyFontROM[index][2*(i+1)+3])+Hershry_Y_Offset) *charScale+.5);
+					int x0 = charX + int(float(px)*charScale+.5)+xStartOffset*charScale;
+					int y0 = charY + int( (float(py)+Hershry_Y_Offset)*charScale+.5);
+					int x1 = charX + int(float(vx)*charScale+.5) + xStartOffset*charScale;
+					int y1 = charY + int( (float(vy)+Hershry_Y_Offset) *charScale+.5);
 					plotLine(x0, y0, x1, y1);
 				} 
+				px = vx;
+				py = vy;
+				penDown = true;
 			}
-			////////////////charX += int(float(HersheyFontROM[index][1]) * charScale + .5); //increment x by character width
 		  
 			 //Done with Character Plotting, reset  _graphDensity value to the temp value...
 			_graphDensity = tempDensity;
-
-
-
-			
-			
+
 			//Move charX to the right by one character size...
 			charX = charX + int(float(charWidth) * charScale +.5);//Move to the right one place...
 			if (charX + charHt > 4095) {//Perform NEW LINE function if we will spill over...
 				charX = 0;
 				charY = charY - int(float(HersheyCharHt) * charScale +.5);
 			}
-		  
-			//  Serial.println(x);
 		}
 		#endif	//END Compiler Switch for Hershey Font Plotting Program
 	}
 
+	bool XYscope::hersheyCharLayout(char &c, int charHt, float &charScale, int &xStartOffset, int &charWidth) {
+		//	Works out the HERSHEY character cell used by plotChar_H() and primChar().
+		//	Uses the precomputed left & right extents of the character (HersheyGlyphIndex[]) to set the cell width
+		//	(proportional or mono spaced per _fontSpacing) and the offset that centers the character in its cell.
+		//
+		//	Calling parameters:
+		//		c			Ascii Character.  Undefined characters are changed to '~' unless CFG_IgnoreUndefinedCharacters=true
+		//		charHt		Character height in pixels
+		//
+		//	Returns: false if the character is to be ignored (or Hershey font is not included); otherwise true with
+		//			 charScale (pixels per ROM unit), xStartOffset (ROM units) and charWidth (ROM units) set.
+		//
+		//	20261017 Ver 0.0	Pulled out of plotChar_H (no change in results)
+		//	20261017 Ver 0.1	Scans the packed HersheyVertexStream[]
+		//	20261017 Ver 0.2	Cell extents come from the precomputed HersheyGlyphIndex[] metrics; no vertex scan
+		//
+		#if CFG_IncludeHersheyFontROM == true
+			bool forceMonospacing=true;
+			if(c < 45 || c > 57) forceMonospacing=false;	//set flag to force mono spacing for Neg_sign, numbers, decimal point		
+			
+			if(c < 32 || c > 126) //ensure that character is in table and handle errors per CONFIGURATION file setting
+			{
+				if(CFG_IgnoreUndefinedCharacters) return false;	//Ignore
+				c='~';	//Set to squiggly if out of range	
+			}
+			
+			const HersheyGlyph &glyph = HersheyGlyphIndex[c - 32];	//Precomputed metrics for this character
+			int HersheyCharCellWidth = glyph.CellRight - glyph.CellLeft;	//Width spanned by the verticies of the current character
+			charScale = float(charHt)/float(HersheycharHt); // scale factor
+
+			charWidth = int(float(_fontSpacing)*2.3);	//This is the default width for MONO spaced characters
+			//Spacing constants...prop = 0, monoTight = 8, mono = 10, monoNorm = 10, monoWide = 12;//Define FontSpacing  Constants
+			if (_fontSpacing == prop ) {	//Are we running in a Proportional Spacing Mode?
+				charWidth = glyph.Advance;	//Get the exact cell size for the current character
+			}
+			if (forceMonospacing) {
+				charWidth = int(float(mono)*2.3);
+			}
+			//This is Left-Right Self-centering the current character code....
+			xStartOffset =int(float(charWidth - HersheyCharCellWidth)/2. +.5);
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
 
 
 	//#if CFG_IncludeVectorFontROM == true
@@ -1912,12 +2931,16 @@ void XYscope::printSetup(short textX, short textY, short textSize = -1,
 	//		textBright	Sets text brightness (%). Range: 1 to approx 255, Larger=BRIGHTER.
 	//				Values less than 25% will be less bright and or lower text quality.
 	//
+	//		textJustify	LtJustify, RtJustify or CtrJustify.  Each following print(text) call is placed so the
+	//				text starts at (Lt), ends at (Rt) or is centered on (Ctr) the current X location.
+	//
 	//-----OTHER NOTES
 	//	Use int GetTextIntensity() to read current text setting.
 	//	SetTextIntensity(value) is an alternate way to set text brightness value
 	//	Returns:  NOTHING
 	//
 	//	201703610 Ver 0.0	E.Andrews	First cut
+	//	20261017 Ver 0.1	textJustify is now used by print(text)
 	//
 	charX = textX;
 	charY = textY;
@@ -1931,6 +2954,7 @@ void XYscope::printSetup(short textX, short textY, short textSize = -1,
 		case RtJustify:
 		case CtrJustify:
 			_fontJustifyFlag=textJustify;
+			_fontJustifyEnab=(textJustify != LtJustify);
 		break;
 		default:
 		break;
@@ -1959,17 +2983,237 @@ void XYscope::print(char const* text, bool UL_Flag = false) {
 	//
 	//	201703610 Ver 0.0	E.Andrews	First cut
 	//	201806110 Ver 0.1	E.Andrews	Change from 'char * text' to 'char const * text'
+	//	20261017 Ver 0.2	Right & Center justification (set by printSetup) about the current X location
 	//	
+	if (_fontJustifyEnab) {	//Shift start left so the text ends at (RtJustify) or is centered on (CtrJustify) charX
+		int textWidth = getTextWidth(text);
+		if (_fontJustifyFlag == RtJustify) charX = charX - textWidth;
+		if (_fontJustifyFlag == CtrJustify) charX = charX - textWidth / 2;
+		if (charX < 0) charX = 0;
+	}
 	int textPtr = 0;
 	while (text[textPtr] != 0) {
 		if (UL_Flag)
 			plotCharUL(text[textPtr], charX, charY, charSize);
 		else
 			plotChar(text[textPtr], charX, charY, charSize);
-			textPtr++;
+		textPtr++;
+	}
+
+}
+
+int XYscope::getTextWidth(char const* text) {
+	//	Measures a text string without plotting it.
+	//
+	//	Calling parameters:
+	//	
+	//		text	String of text to be measured
+	//
+	//	Returns:  Width in pixels that print(text) would move charX using the current font, text size (printSetup)
+	//			  and font spacing.  The text is measured as one line (no wrap to the next line).
+	//
+	//	20261017 Ver 0.0	First cut
+	//	
+	int textWidth = 0;
+	int textPtr = 0;
+	while (text[textPtr] != 0) {
+		textWidth = textWidth + charAdvance(text[textPtr], charSize);
+		textPtr++;
+	}
+	return textWidth;
+}
+
+int XYscope::charAdvance(char c, int charHt) {
+	//	Returns how far plotChar() moves charX for character c (same arithmetic as plotChar_V/plotChar_H).
+	//	Nothing is plotted and no font vertices are read.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (ActiveFont == _HersheyFont) {
+		#if CFG_IncludeHersheyFontROM == true
+			float charScale;
+			int xStartOffset, charWidth;
+			if (!hersheyCharLayout(c, charHt, charScale, xStartOffset, charWidth)) return 0;	//Ignored characters do not move
+			return int(float(charWidth) * charScale +.5);
+		#endif
+	}
+	if (ActiveFont == _VectorFont) {
+		#if CFG_IncludeVectorFontROM == true
+			float Char_ScaleFactor = float(charHt) / 16.;
+			if ((c < 32 || c > 126) && !CFG_IgnoreUndefinedCharacters) c = '~';
+			int charWidth = _fontSpacing;
+			if (_fontSpacing == 0) {	//_fontSpacing=0 for Proportional Spacing...
+				charWidth = int((Ascii2Font[uint8_t(c)]) >> 9) & 0x0f;
+			}
+			return int(charWidth * Char_ScaleFactor);
+		#endif
 	}
+	return 0;
+}
+bool XYscope::glyphCachePlot(char c, int &charX, int &charY, int &charHt) {
+	//	Plots character c from the glyph cache: its points, rasterized once at the cell origin GlyphOrigin, are
+	//	moved to charX, charY and added to the list in one block.  A character not in the cache yet is rasterized
+	//	and added to it first (glyphCacheAdd).  The result is the same as plotChar_V/plotChar_H would give.
+	//
+	//	Returns: false if the cache is off or c can't be cached (too tall, undefined, list full, cell origin off
+	//			 the bottom or left of the screen, 2D transform on); the caller then plots it the usual way.
+	//			 Otherwise true, with charX & charY moved on as plotChar does.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	#if CFG_GlyphCacheBytes > 0 && CFG_GlyphCacheGlyphs > 0
+		if (charHt < 1 || charHt > GlyphMaxHt || _xfOn) return false;	//(Transformed text is rasterized)
+		if (charX < 0 || charY < 0) return false;	//The rasterizers round toward 0, so a cell left of or below the screen isn't a plain translation
+		glyphEntry *e = NULL;
+		for (int i = 0; i < GlyphSlots && !e; i++) {
+			glyphEntry &g = _glyphs[i];
+			if (g.lastUse != 0 && g.c == c && g.charHt == charHt && g.font == ActiveFont && g.density == _textDensity && g.spacing == _fontSpacing) e = &g;
+		}
+		if (e) _glyphHits++;
+		else {
+			_glyphMisses++;
+			e = glyphCacheAdd(c, charHt);
+			if (!e) return false;
+		}
+		e->lastUse = ++_glyphClock;
+
+		//Translate the points to the character cell
+		const glyphPoint *g = &_glyphPool[e->first];
+		if (onScreen(charX + e->xMin, charY + e->yMin, charX + e->xMax, charY + e->yMax)) {
+			int count = e->count;
+			pointList *p = plotReserve(count);
+			for (int i = 0; i < count; i++) setPoint(p[i], charX + g[i].x, charY + g[i].y);
+			plotAppend(count);
+		} else {
+			screenSaverKick();
+			for (int i = 0; i < e->count; i++) appendPoint(charX + g[i].x, charY + g[i].y);
+		}
+		plotErr = 0;
+
+		//Move charX to the right by one character size; NEW LINE as plotChar_V/plotChar_H do it
+		charX = charX + e->advance;
+		if (charX + charHt > 4095) {
+			charX = 0;
+			if (e->font == _VectorFont) {
+				float Char_ScaleFactor = float(charHt) / 16.;
+				charY = charY - 15 * Char_ScaleFactor;
+			} else {
+				#if CFG_IncludeHersheyFontROM == true
+					float charScale = float(charHt) / float(HersheycharHt);
+					charY = charY - int(float(HersheycharHt) * charScale + .5);
+				#endif
+			}
+		}
+		return true;
+	#else
+		(void) c; (void) charX; (void) charY; (void) charHt;	//Cache compiled out
+		return false;
+	#endif
+}
+
+XYscope::glyphEntry *XYscope::glyphCacheAdd(char c, int charHt) {
+	//	Rasterizes character c in the active font with its cell at GlyphOrigin, GlyphOrigin (the points go to the
+	//	end of the list and are taken back out) and keeps the points, relative to the cell, in the glyph cache.
+	//	The least recently used characters are dropped until there is a free slot and room in _glyphPool.
+	//
+	//	Returns: The new cache slot, or NULL if c isn't plotted (undefined), wraps to a new line, doesn't fit in
+	//			 the list or in the cache, or has points off screen (which plotChar would have dropped).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	#if CFG_GlyphCacheBytes > 0 && CFG_GlyphCacheGlyphs > 0
+		int start = XYlistEnd;
+		uint32_t largeSteps = _buildLargeSteps;
+		int x = GlyphOrigin, y = GlyphOrigin, ht = charHt;
+		if (ActiveFont == _VectorFont) plotChar_V(c, x, y, ht);
+		if (ActiveFont == _HersheyFont) plotChar_H(c, x, y, ht);
+		int count = XYlistEnd - start;
+		bool ok = plotErr == 0 && count <= GlyphPoolSize && y == GlyphOrigin && plotRoom() > 0;
+		int xMin = GlyphOrigin, yMin = GlyphOrigin, xMax = GlyphOrigin, yMax = GlyphOrigin;	//(a space has no points)
+		for (int i = start; i < XYlistEnd && ok; i++) {
+			int px = XY_List[i].X & 0xfff, py = XY_List[i].Y & 0xfff;
+			if (i == start) {xMin = xMax = px; yMin = yMax = py;}
+			xMin = min(xMin, px); xMax = max(xMax, px);
+			yMin = min(yMin, py); yMax = max(yMax, py);
+		}
+		ok = ok && xMin > 0 && yMin > 0 && xMax < 4095 && yMax < 4095;	//Nothing near the edges, so nothing was dropped
+
+		glyphEntry *e = NULL;
+		if (ok) {
+			for (;;) {
+				glyphEntry *lru = NULL;
+				e = NULL;
+				for (int i = 0; i < GlyphSlots; i++) {
+					if (_glyphs[i].lastUse == 0) {if (!e) e = &_glyphs[i];}
+					else if (!lru || _glyphs[i].lastUse < lru->lastUse) lru = &_glyphs[i];
+				}
+				if (e && _glyphPoolUsed + count <= GlyphPoolSize) break;
+				glyphCacheDrop(*lru);	//lru can't be NULL here: an empty cache has free slots & room
+			}
+			e->c = c;
+			e->charHt = charHt;
+			e->font = ActiveFont;
+			e->density = _textDensity;
+			e->spacing = _fontSpacing;
+			e->advance = x - GlyphOrigin;
+			e->xMin = xMin - GlyphOrigin; e->yMin = yMin - GlyphOrigin;
+			e->xMax = xMax - GlyphOrigin; e->yMax = yMax - GlyphOrigin;
+			e->first = _glyphPoolUsed;
+			e->count = count;
+			glyphPoint *g = &_glyphPool[e->first];
+			for (int i = 0; i < count; i++, g++) {
+				g->x = (XY_List[start + i].X & 0xfff) - GlyphOrigin;
+				g->y = (XY_List[start + i].Y & 0xfff) - GlyphOrigin;
+			}
+			_glyphPoolUsed += count;
+			e->lastUse = ++_glyphClock;
+		}
+
+		//Take the points back out of the list
+		XYlistEnd = start;
+		_buildLargeSteps = largeSteps;
+		return e;
+	#else
+		(void) c; (void) charHt;	//Cache compiled out
+		return NULL;
+	#endif
+}
+
+void XYscope::glyphCacheDrop(glyphEntry &e) {
+	//	Frees a glyph cache slot.  The points of the characters after it in _glyphPool are moved down over its
+	//	points so the free room is always at the end of the pool.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	uint16_t end = e.first + e.count;
+	memmove(&_glyphPool[e.first], &_glyphPool[end], (_glyphPoolUsed - end) * sizeof(glyphPoint));
+	for (int i = 0; i < GlyphSlots; i++)
+		if (_glyphs[i].lastUse != 0 && _glyphs[i].first >= end) _glyphs[i].first -= e.count;
+	_glyphPoolUsed -= e.count;
+	e.lastUse = 0;
+}
 
+uint32_t XYscope::getGlyphCacheHits(void) {
+	return _glyphHits;
 }
+
+uint32_t XYscope::getGlyphCacheMisses(void) {
+	return _glyphMisses;
+}
+
+void XYscope::glyphCacheClear(void) {
+	//	Empties the glyph cache and zeroes its hit & miss counts.  Not needed when the font, size, density or
+	//	spacing changes: they are part of the cache key.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	for (int i = 0; i < GlyphSlots; i++) _glyphs[i].lastUse = 0;
+	_glyphPoolUsed = 0;
+	_glyphClock = 0;
+	_glyphHits = 0;
+	_glyphMisses = 0;
+}
+
 void XYscope::printUnderline(int nPlaces) {
 	//	Print underline character to screen at current x-y locations.
 	//
@@ -2203,6 +3447,480 @@ void XYscope::print(float number, int placesToPrint = 2, bool UL_Flag = false) {
 
 }
 
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//Primitive Display List
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+//	Instead of expanding every figure into XY_List points, prim...() routines store the figure itself
+//	(16 bytes each) in XY_PrimList.  The PIO refresh routines rasterize the list every paint using
+//	integer steppers (Bresenham lines, phase-accumulator circles & ellipses, Hershey glyph walkers).
+//	Enable with CFG_PrimitiveDisplayList in XYscopeConfig.h.
+//
+
+void XYscope::primClear() {
+	//	Erases all primitives from the primitive display list.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	_primCount = 0;
+}
+
+XYscope::primitive * XYscope::primAdd(uint8_t type, uint8_t density) {
+	//	Returns the next free primitive slot, pre-loaded with 'type' & 'density'.  Caller fills in the rest and
+	//	THEN bumps _primCount, so the refresh interrupt never sees a half written primitive.
+	//	Returns NULL (and sets plotErr) if the primitive list is full or not enabled.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (!CFG_PrimitiveDisplayList || _primCount >= MaxPrimitives) {
+		plotErr = 1;
+		return NULL;
+	}
+	if (_screenOnTime_ms != 0) _crtOffTOD_ms = millis() + _screenOnTime_ms;//Update ScreenOff time of day (ms)	
+
+	primitive *p = &XY_PrimList[_primCount];
+	p->type = type;
+	p->code = 0;
+	p->density = density;
+	p->spare = 0;
+	p->step = 0;
+	return p;
+}
+
+void XYscope::primPoint(int x0, int y0) {
+	//	Adds a POINT primitive.  Same coordinate rules as plotPoint().
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	primitive *p = primAdd(_primPointType, 0);
+	if (p == NULL) return;
+	p->x0 = x0;
+	p->y0 = y0;
+	_primCount++;
+}
+
+void XYscope::primLine(int x0, int y0, int x1, int y1) {
+	//	Adds a LINE primitive.  The line is rasterized exactly like plotLine() (Bresenham, every
+	//	_graphDensity+1 steps), using the graphics intensity in effect when primLine() is called.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	primitive *p = primAdd(_primLineType, constrain(_graphDensity, 0, 255));
+	if (p == NULL) return;
+	p->x0 = x0;
+	p->y0 = y0;
+	p->x1 = x1;
+	p->y1 = y1;
+	_primCount++;
+}
+
+void XYscope::primRectangle(int x0, int y0, int x1, int y1) {
+	//	Adds a RECTANGLE as four LINE primitives (see plotRectangle).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	primLine(x0, y0, x1, y0);	//Top horizontal line
+	primLine(x1, y0, x1, y1);	//Right verticle line
+	primLine(x1, y1, x0, y1);	//Bottom horizontal line
+	primLine(x0, y1, x0, y0);	//Left verticle line
+}
+
+void XYscope::primCircle(int xc, int yc, int r, uint8_t arcSegment) {
+	//	Adds a CIRCLE (or arc) primitive.  Same parameters as plotCircle().
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	primEllipse(xc, yc, r, r, arcSegment);
+}
+
+void XYscope::primEllipse(int xc, int yc, int xr, int yr, uint8_t arcSegment) {
+	//	Adds an ELLIPSE (or arc) primitive.  Same parameters, arc segment numbering & point spacing as plotEllipse().
+	//	The number of points per revolution is worked out here, once, and stored as a 32-bit phase step
+	//	(2^32 = full circle) so the paint loop needs only integer adds and sine table look-ups.
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Phase step shared with plotEllipse (arcPhaseStep)
+	//
+	primitive *p = primAdd(_primEllipseType, constrain(_graphDensity, 0, 255));
+	if (p == NULL) return;
+
+	p->code = arcSegment;
+	p->x0 = xc;
+	p->y0 = yc;
+	p->x1 = xr;
+	p->y1 = yr;
+	p->step = arcPhaseStep(xr, yr);
+	_primCount++;
+}
+
+void XYscope::primChar(char c, int& charX, int& charY, int& charHt) {
+	//	Adds a HERSHEY font GLYPH reference (character, cell origin & scale) to the primitive list.
+	//	charX & charY are advanced (and wrapped) exactly as plotChar() does, so the same layout code can
+	//	be used with either routine.  Glyph primitives always use the Hershey font.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	plotErr = 0;
+	#if CFG_IncludeHersheyFontROM == true
+		float charScale;
+		int xStartOffset, charWidth;
+		if (!hersheyCharLayout(c, charHt, charScale, xStartOffset, charWidth)) {
+			plotErr = 1;	//Undefined character is being ignored
+			return;
+		}
+		if (HersheyGlyphIndex[c - 32].Length > 0) {	//Blanks (space) only move the cursor
+			primitive *p = primAdd(_primGlyphType, constrain(_textDensity, 0, 255));
+			if (p == NULL) return;
+			p->code = c - 32;
+			p->x0 = charX + int(xStartOffset * charScale);
+			p->y0 = charY;
+			p->x1 = int(charScale * 256. + .5);	//Q8 scale
+			_primCount++;
+		}
+		charX = charX + int(float(charWidth) * charScale +.5);//Move to the right one place...
+		if (charX + charHt > 4095) {//Perform NEW LINE function if we will spill over...
+			charX = 0;
+			charY = charY - int(float(HersheycharHt) * charScale +.5);
+		}
+	#else
+		plotErr = 1;
+	#endif
+}
+
+void XYscope::primPrint(char const* text) {
+	//	Adds a string of glyph primitives at the current printSetup() location & size.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int textPtr = 0;
+	while (text[textPtr] != 0) {
+		primChar(text[textPtr], charX, charY, charSize);
+		textPtr++;
+	}
+}
+
+int XYscope::getPrimCount() {
+	//	Returns the number of primitives currently in the primitive display list.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _primCount;
+}
+
+uint32_t XYscope::getPrimBytesUsed() {
+	//	Returns RAM (in bytes) used by the primitives currently in the primitive display list.
+	//	Compare with 4 X getPrimPointsPainted() = bytes the same figures would need in XY_List.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return uint32_t(_primCount) * sizeof(primitive);
+}
+
+uint32_t XYscope::getPrimPointsPainted() {
+	//	Returns the number of points rasterized from the primitive display list during the last paint.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _primPointsPainted;
+}
+
+static inline int32_t sineTableLookup(uint32_t idx) {
+	//	sin(idx * 2pi/1024) in Q15, built from the quarter-wave table by symmetry.
+	idx &= 1023;
+	uint32_t k = idx & 255;
+	int32_t v = (idx & 256) ? SineQuarterWave[256 - k] : SineQuarterWave[k];
+	return (idx & 512) ? -v : v;
+}
+
+int32_t XYscope::sinQ15(uint32_t phase) {
+	//	Returns sin(phase) in Q15 (32767 = 1.0), where phase is a 32-bit angle (2^32 = full circle).
+	//	Upper 10 bits select the table entry; the next 8 bits linearly interpolate to the following entry.
+	//	cos(phase) = sinQ15(phase + 0x40000000).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	uint32_t idx = phase >> 22;
+	int32_t frac = (phase >> 14) & 0xff;
+	int32_t s0 = sineTableLookup(idx);
+	int32_t s1 = sineTableLookup(idx + 1);
+	return s0 + (((s1 - s0) * frac) >> 8);
+}
+
+void XYscope::lineStepStart(lineStepper &ls, int x0, int y0, int x1, int y1, int density) {
+	//	Loads a line stepper.  Points are plotted at the same places as the original Bresenham plotLine()
+	//	(start point, then every density+1 steps along the longer axis) with the shorter axis rounded to the
+	//	nearest count (within one count of Bresenham).
+	//
+	//	Calling parameters:
+	//		x0, y0, x1, y1	Line end points
+	//		density			Points skipped between plotted points (_graphDensity or _textDensity)
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int dx = abs(x1 - x0);
+	int dy = abs(y1 - y0);
+	int stride = (density > 0 ? density : 0) + 1;	//Bresenham steps from one plotted point to the next
+	int major = dx > dy ? dx : dy;
+	int minor = dx > dy ? dy : dx;
+	ls.x = x0;
+	ls.y = y0;
+	ls.xMajor = (dx > dy);
+	ls.count = major / stride + 1;
+	ls.majorStep = (ls.xMajor ? (x0 < x1) : (y0 < y1)) ? stride : -stride;
+	ls.minorSign = (ls.xMajor ? (y0 < y1) : (x0 < x1)) ? 1 : -1;
+	if (major == 0) {	//Single point
+		ls.minorWhole = 0;
+		ls.minorFrac = 0;
+		ls.minorDen = 1;
+		ls.minorRem = 0;
+		return;
+	}
+	//Minor axis offset after k steps = round(k * minor / major) = (2*k*minor + major) / (2*major)
+	ls.minorDen = 2 * major;
+	ls.minorWhole = (2 * stride * minor) / ls.minorDen;
+	ls.minorFrac = (2 * stride * minor) % ls.minorDen;
+	ls.minorRem = major;
+}
+
+static inline int64_t floorDiv(int64_t a, int64_t b) {
+	//	a / b rounded toward minus infinity (b > 0)
+	return a >= 0 ? a / b : -((b - 1 - a) / b);
+}
+
+void XYscope::lineStepClip(lineStepper &ls) {
+	//	Clips a freshly loaded line stepper to the screen (0 to 4095), Liang-Barsky style.  Both axes of the
+	//	stepper move one way only, so its on-screen points are a single run of steps; the first & last steps of
+	//	that run are solved for with the stepper's own integer math and the stepper jumps straight to the first.
+	//	The points left are exactly the on-screen points of the whole line; the off-screen ones cost nothing.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (ls.count <= 0) return;
+	int64_t kMin = 0, kMax = ls.count - 1;	//Run of steps to keep
+
+	//Major axis: at step k it is p0 + k * majorStep
+	int64_t p0 = ls.xMajor ? ls.x : ls.y;
+	int64_t stride = abs(ls.majorStep);
+	if (ls.majorStep > 0) {
+		kMin = max(kMin, -floorDiv(p0, stride));			//ceil(-p0 / stride)
+		kMax = min(kMax, floorDiv(4095 - p0, stride));
+	} else {
+		kMin = max(kMin, -floorDiv(4095 - p0, stride));		//ceil((p0 - 4095) / stride)
+		kMax = min(kMax, floorDiv(p0, stride));
+	}
+
+	//Minor axis: at step k it is q0 + minorSign * (minorRem + k * perStep) / minorDen
+	int64_t q0 = ls.xMajor ? ls.y : ls.x;
+	int64_t lo = ls.minorSign > 0 ? -q0 : q0 - 4095;		//Minor axis offsets that are on screen: lo to hi
+	int64_t hi = ls.minorSign > 0 ? 4095 - q0 : q0;
+	int64_t perStep = int64_t(ls.minorWhole) * ls.minorDen + ls.minorFrac;
+	if (hi < 0) kMax = -1;
+	else if (perStep == 0) {
+		if (lo > 0) kMax = -1;
+	} else {
+		if (lo > 0) kMin = max(kMin, -floorDiv(ls.minorRem - lo * ls.minorDen, perStep));
+		kMax = min(kMax, floorDiv((hi + 1) * ls.minorDen - 1 - ls.minorRem, perStep));
+	}
+	if (kMax < kMin) {	//Nothing on screen
+		ls.count = 0;
+		return;
+	}
+
+	//Jump to step kMin
+	int64_t minorNum = ls.minorRem + kMin * perStep;
+	int minorOffset = int(minorNum / ls.minorDen);
+	ls.minorRem = int(minorNum % ls.minorDen);
+	if (ls.xMajor) {
+		ls.x += int(kMin) * ls.majorStep;
+		ls.y += ls.minorSign * minorOffset;
+	} else {
+		ls.y += int(kMin) * ls.majorStep;
+		ls.x += ls.minorSign * minorOffset;
+	}
+	ls.count = int(kMax - kMin + 1);
+}
+
+inline bool XYscope::lineStepNext(lineStepper &ls, int &X, int &Y) {
+	//	Returns the next plotted point of a line stepper; false once the line is done.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (ls.count <= 0) return false;
+	X = ls.x;
+	Y = ls.y;
+	ls.count--;
+	int minorStep = ls.minorWhole;
+	ls.minorRem += ls.minorFrac;
+	if (ls.minorRem >= ls.minorDen) {
+		ls.minorRem -= ls.minorDen;
+		minorStep++;
+	}
+	if (ls.xMajor) {
+		ls.x += ls.majorStep;
+		ls.y += ls.minorSign * minorStep;
+	} else {
+		ls.y += ls.majorStep;
+		ls.x += ls.minorSign * minorStep;
+	}
+	return true;
+}
+
+void XYscope::primLineStart(int x0, int y0, int x1, int y1, uint8_t density) {
+	//	Loads the primitive rasterizer's line stepper (same points as plotLine).
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Uses lineStepper
+	//	20261017 Ver 0.2	Clipped to the screen (lineStepClip)
+	//
+	lineStepStart(_rsLine, x0, y0, x1, y1, density);
+	if (!onScreen(min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1))) lineStepClip(_rsLine);
+	_rsLineActive = true;
+}
+
+bool XYscope::primLineNext(int &X, int &Y) {
+	//	Steps the line stepper to its next plotted point.  Returns false once the end point has been passed.
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Uses lineStepper
+	//
+	if (_rsLineActive && lineStepNext(_rsLine, X, Y)) return true;
+	_rsLineActive = false;
+	return false;
+}
+
+void XYscope::primRasterStart(void) {
+	//	Rewinds the primitive rasterizer.  Called by the refresh routine at the start of each paint.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	_rsPrim = 0;
+	_rsActive = false;
+	_rsLineActive = false;
+}
+
+bool XYscope::primNextPoint(short &X, short &Y) {
+	//	Rasterizes the next point of the primitive display list.  Called by the PIO refresh routines
+	//	once per point; all state is kept in the _rs... stepper variables, so no points are ever stored.
+	//	Off-screen points are skipped or folded over per 'PreventScreenWrap', just like plotPoint().
+	//
+	//	Returns:	true, with (X,Y) loaded with the next point ready for the DACs.
+	//				false, when every primitive has been painted.
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Screen wrap check tests every bit above bit 11, as plotPoint() does
+	//
+	primitive *p;
+	int x = 0, y = 0;
+	bool got;
+
+	while (_rsPrim < _primCount) {
+		p = &XY_PrimList[_rsPrim];
+		got = false;
+		switch (p->type) {
+			case _primPointType:
+				x = p->x0;
+				y = p->y0;
+				got = true;
+				_rsPrim++;
+				break;
+
+			case _primLineType:
+				if (!_rsActive) {
+					primLineStart(p->x0, p->y0, p->x1, p->y1, p->density);
+					_rsActive = true;
+				}
+				got = primLineNext(x, y);
+				if (!got) {
+					_rsActive = false;
+					_rsPrim++;
+				}
+				break;
+
+			case _primEllipseType:
+				if (!_rsActive) {
+					_rsPhase = 0;
+					_rsLast = false;
+					_rsActive = true;
+				}
+				while (!got) {
+					if (_rsLast) {	//Full revolution done
+						_rsActive = false;
+						_rsPrim++;
+						break;
+					}
+					uint32_t phase = _rsPhase;
+					_rsPhase += p->step;
+					if (_rsPhase <= phase) _rsLast = true;	//Phase wrapped...this is the last point
+					if (p->code & (1 << (phase >> 29))) {	//Only plot those arc segments that are enabled
+						x = p->x0 - ((p->x1 * sinQ15(phase + 0x40000000UL) + 16384) >> 15);	//X = xc - cos(angle) * xr
+						y = p->y0 + ((p->y1 * sinQ15(phase) + 16384) >> 15);				//Y = yc + sin(angle) * yr
+						got = true;
+					}
+				}
+				break;
+
+			case _primGlyphType:
+				#if CFG_IncludeHersheyFontROM == true
+				{
+					int index = p->code;
+					if (!_rsActive) {
+						_rsVertex = 0;
+						_rsPenDown = false;
+						_rsLineActive = false;
+						_rsActive = true;
+					}
+					while (!got) {
+						if (_rsLineActive && primLineNext(x, y)) {
+							got = true;
+							break;
+						}
+						if (_rsVertex >= HersheyGlyphIndex[index].Length) {	//All vectors of this glyph done
+							_rsActive = false;
+							_rsPrim++;
+							break;
+						}
+						const int8_t *v = &HersheyVertexStream[HersheyGlyphIndex[index].Offset + _rsVertex];
+						if (*v == HersheyPenUp) {	//'penUp'
+							_rsPenDown = false;
+							_rsVertex++;
+							continue;
+						}
+						int vx = v[0], vy = v[1];
+						_rsVertex += 2;
+						if (_rsPenDown) {
+							int yOffset = HersheyBaselineOffset;	//The Hershey ROM is biased up by about 1/2 a character cell...
+							primLineStart(p->x0 + ((_rsPenX * p->x1 + 128) >> 8), p->y0 + (((_rsPenY + yOffset) * p->x1 + 128) >> 8),
+										  p->x0 + ((vx * p->x1 + 128) >> 8), p->y0 + (((vy + yOffset) * p->x1 + 128) >> 8), p->density);
+						}
+						_rsPenX = vx;
+						_rsPenY = vy;
+						_rsPenDown = true;
+					}
+				}
+				#else
+					_rsPrim++;
+				#endif
+				break;
+
+			default:
+				_rsPrim++;
+				break;
+		}
+		if (got) {
+			if ((((x & ~0xfff) != 0) || ((y & ~0xfff) != 0)) && PreventScreenWrap) continue;	//Skip off-screen points
+			#if defined(__SAM3X8E__)
+				X = (x & 0xfff) | X_flag;
+				Y = (y & 0xfff) | Y_flag;
+			#else
+				X = (x & 0xfff);
+				Y = (y & 0xfff);
+			#endif
+			return true;
+		}
+	}
+	return false;
+}
+
 void XYscope::setDmaClockRate(uint32_t New_XfrRate_hz) {
 	//	Routine to setup Timer Counter 0 which is used to clock DMA transformers.
 	//	(This is just a CALLER FRIENDLIER version of tcSetup)
@@ -2278,47 +3996,19 @@ void XYscope::tcSetup(uint32_t New_XfrRateHz) {
 	//
 	//	20170405 Ver 0.0	E.Andrews	First cut
 	//	20180425 Ver 1.0	E.Andrews	DO NOTHING if running a TEENSY 3.6
+	//	20261017 Ver 1.1				TC0 register setup moved to DueDmaOutput::setClock() (XYscopeBackend.h)
 	//
 	
 	#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE	
 		if (New_XfrRateHz > 0)	//DO NOTHING if XfrRateHz is zero or less.
 		{
-			uint32_t tcTicks = FreqToTimerTicks(New_XfrRateHz);	//Convert "Hz value" to "Clock Ticks"
-			// Send TC0 Clock signal to external pin so AGS hardware can se it to sync things up
-			int ulPin = 2; // just an example:   it's 2  for the Timer0 TIOAO
-			PIO_Configure(g_APinDescription[ulPin].pPort,
-					g_APinDescription[ulPin].ulPinType,
-					g_APinDescription[ulPin].ulPin,
-					g_APinDescription[ulPin].ulPinConfiguration);
-
-			// Enable TC0  
-			pmc_enable_periph_clk (TC_INTERFACE_ID);
-
-			//Set Mode and Frequency of TC0
-			Tc * tc = TC0;
-			TcChannel * t = &tc->TC_CHANNEL[0];
-			t->TC_CCR = TC_CCR_CLKDIS;
-			t->TC_IDR = 0xFFFFFFFF;
-			t->TC_SR;
-			t->TC_RC = tcTicks;    		// Sets PERIOD of timer in "tcTicks" units
-			t->TC_RA = (tcTicks - tcTicks / 2);	// Use this value to alter clock signal symmetry...(tcTicks/2 = 50%)
-
-			//TC_CMR = Timer Counter Channel Mode Register, a four byte register used to set WAVEFORM MODE
-			//	Note: Since the DUE MCK = 84 MHz, the following master clock source settings are available
-			// 		TC-CMR_TCCLOCKS_TIMER_CLOCK1 sets the clock source to be =  MCK/2  (48.0   MHz)
-			// 		TC-CMR_TCCLOCKS_TIMER_CLOCK2 sets the clock source to be =  MCK/8  (10.5   MHz)
-			// 		TC-CMR_TCCLOCKS_TIMER_CLOCK3 sets the clock source to be =  MCK/32 ( 2.652 MHz)
-			// 		TC-CMR_TCCLOCKS_TIMER_CLOCK3 sets the clock source to be =  MCK/128( 0.65625 MHz or 656.25 KHz)
-			t->TC_CMR = TC_CMR_TCCLKS_TIMER_CLOCK1 | TC_CMR_WAVE
-					| TC_CMR_WAVSEL_UP_RC;
-			t->TC_CMR = (t->TC_CMR & 0xFFF0FFFF) | TC_CMR_ACPA_CLEAR
-					| TC_CMR_ACPC_SET;
-			t->TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
-
+			DueDmaOutput::setClock(FreqToTimerTicks(New_XfrRateHz));	//Convert "Hz value" to "Clock Ticks" and start TC0
 		
 			//Setup is done; Remember the setting for later recall as needed
 			DmaClkFreq_Hz = New_XfrRateHz;
 		}
+	#else
+		(void) New_XfrRateHz;
 	#endif	//End Arduino DUE code block
 }
 
@@ -2334,96 +4024,21 @@ void XYscope::dacSetup(void) {
 	//	Returns:	Nothing.
 	//
 	//	20170407 Ver 0.0	E.Andrews	First cut
-	//	20180425 Ver 1.0	E.Andrews	Now routine does DAC setup for both DUE and TEENSY 3.6
-	//
-	#if defined(__MK66FX1M0__)	//Only compile this code block for TEENSY 3.6
-		//----------------------------------------------------    
-		//  TEENSY 3.6  DAC SETUP
-		//----------------------------------------------------
-		SIM_SCGC2 |= SIM_SCGC2_DAC0; // enable DAC0 clock
-		SIM_SCGC2 |= SIM_SCGC2_DAC1; // enable DAC1 clock
-		//There are three DAC control registers for each DAC (0,1,2).   DACx_C0, DACx_C1, DACx_C2 where x= DAC # (0 or 1)
-
-		//==DAC Control Register_0 Setup
-		#if defined CFG_TNSY_DacRefVolts_LOW
-			DAC0_C0 = DAC_C0_DACEN; 				//Enab DAC_0 using 1.5V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
-			DAC1_C0 = DAC_C0_DACEN; 				//Enab DAC_1 using 1.5V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
-		#else
-			DAC0_C0 = DAC_C0_DACEN | DAC_C0_DACRFS; //Enab DAC_0 using 3.3V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
-			DAC1_C0 = DAC_C0_DACEN | DAC_C0_DACRFS; //Enab DAC_1 using 3.3V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
-		#endif
-		//----------------------------------------------------    
-		//  END TEENSY 3.6  DAC SETUP
-		//----------------------------------------------------		
-	#endif	
-	
-	#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE
-		//----------------------------------------------------    
-		//  DUE DAC SETUP
-		//----------------------------------------------------
-		pmc_enable_periph_clk (DACC_INTERFACE_ID); 	// start clocking DAC
-
-		dacc_reset (DACC);		//This returns DAC hardware to power-up conditions
-
-		dacc_set_transfer_mode(DACC, 0);//for this variable, 0=HALFWORD_MODE (16 bits integers) or 1=FULLWORD_MODE (32 bit integers)
-		dacc_set_power_save(DACC, 0, 0);	//Setup of DAC Power_Save option
-		// Set DACC Analog Current Register - Use typical recommended values of 0x01 for IBCTLDACCORE and 0x02 for IBCTLCH0/IBCTLCH1
-		// This may sets the slew rate of DACC register & IBCTLDACCH0/IBCTLDACCH1:
-		dacc_set_analog_control(DACC,
-				DACC_ACR_IBCTLCH0(0x02) | DACC_ACR_IBCTLCH1(0x02)
-						| DACC_ACR_IBCTLDACCORE(0x01));
-		dacc_set_trigger(DACC, 1);
-
-		dacc_enable_channel(DACC, 0);	//Enable DAC0
-		dacc_enable_channel(DACC, 1);	//Enable DAC1
-
-		// DACC_MR bit definitions
-		//
-		//	|	31	|	30	|	29	|	28	|	27	|	26	|	25	|	24	|
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	STARTUP TIME: Time till initial startup conversion 
-		//	|		|		|<-------------- STARTUP TIME ----------------->|	0=0 periods of DACC CLOCK, 63=4032 periods of DACC CLOCK 
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	Typical value = 3 to 8. (See table on pg 1366 of HW Data Sheet for more details)
-		//
-		//	|	23	|	22	|	21	|	20	|	19	|	18	|	17	|	16	|
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	MAXS: Startup after wake up; 0=Normal (No Sleep), 1=Fast Wake up Sleep Mode
-		//	|		|		| MAXS	|  TAG	|		|		|<--USER  SEL-->|	TAG: 0=DIS (Tag Selection Mode Disabled, using USER_SEL value to chan conversion
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	USER_SEL: 0=Chan 0 Selected, 1=Chan 1 Selected (Only meaningful when TAG=1)
-		//
-		//	|	15	|	14	|	13	|	12	|	11	|	10	|	 9	|	 8	|
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	DAC AUTO REFRESH PERIOD
-		//	|<----------------------   REFRESH   -------------------------->| 	0: No DAC Refresh, >0: DAC Refresh Period = 1024 * REFRESH_VALUE/DACC_CLOCK
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+
-		//
-		//	|	7	|	6	|	5	|	4	|	3	|	2	|	 1	|	 0	|
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	FAST WKUP: 0=Sleep Mode defined by SLEEP bit, 1=Fast Wak up Sleep Mode (Vref ON Between Conversions but DAC core is OFF)
-		//	|		|FSTWKUP| SLEEP	|WRD MOD|<----- TRIG SEL ------>| TRGEN	|	SLEEP: 0=Normal (No Sleep), 1=Sleep Mode (Sleeps between conversions)
-		//	+-------+-------+-------+-------+-------+-------+-------+-------+	WORD/HALF-WORD MODE: 0=Half Word Mode (16 Bit), 1=Full Word Mode (32 Bit)
-		//																		TRIG SEL: 0=Ext, 1=TC0_CH0, 2=TC0_CH1, 3=TC0_CH2,4=PWM Event_0,5=PWM Event_1,6=RESRVD,7=RESERVD
-		//																		TRGEN (Trig Enable): 0=Disabled, DACC in Free Run Mode, 1=Ext Trig mode.
-		//	DACC_MR REGISTER SETTINGS...
-		//		STARTUP TIME
-		DACC->DACC_MR |= 8 << 24;		//8=512 DACC clock periods of startup time.
-		//		MAXS Mode bit
-		DACC->DACC_MR |= 0 << 16;		//No Bits Set, MAXS=0 meaning NO SLEEP
-		//		TAG MODE Bit
-		DACC->DACC_MR |= 1 << 20;//TAG=1 (Bits 12,13 of incomming data selects DAC0/DAC1 destination )
-		//		DAC REFRESH 
-		DACC->DACC_MR |= 0 << 8;//No Bits Set.  REFRESH=0, meaning NO AUTO REFRESH DESIRED
-		//		FSTWKUP, SLEEP,WRD MODE, TRIG SEL, TRig ENABLE
-		DACC->DACC_MR |= 0;	//No Bits Set.  HALF_WORD MODE, EXT-TRIG, TRIG DISABLED
-
-		//----------------------------------------------------    
-		//  DUE Interrupt Controller SETUP
-		//----------------------------------------------------
-		NVIC_DisableIRQ (DACC_IRQn);//Disable DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
-		NVIC_ClearPendingIRQ(DACC_IRQn);//Clear any pending DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
-		NVIC_EnableIRQ(DACC_IRQn);//Now, ENABLE DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
-		
-		//----------------------------------------------------    
-		//  END DUE DAC SETUP
-		//----------------------------------------------------
-	#endif	//End Arduino DUE code block
-
+	//	20180425 Ver 1.0	E.Andrews	Now routine does DAC setup for both DUE and TEENSY 3.6
+	//	20261017 Ver 1.1				DAC, DACC & blanking pin setup moved to the output backend (XYscopeBackend.h)
+	//	20261017 Ver 1.2				Hooks up the sliced paint software interrupt (CFG_SlicedPaint)
+	//	20261017 Ver 1.3				TEENSY: eDMA & PDB setup (CFG_TnsyDmaPaint)
+	//
+	XYscopePioOutput::begin();	//TEENSY: DAC0/DAC1 & Z pin, DUE: DACC (TAG mode) & DACC IRQ, HOST: simulated beam OFF
+	#if defined (__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		if (CFG_TnsyDmaPaint) {
+			_sliceOwner = this;
+			XYscopeDmaOutput::begin(dmaHalfIsr);	//Sample ring DMA channels, PDB sample clock & half-sent interrupt
+		} else if (CFG_SlicedPaint) {
+			_sliceOwner = this;
+			XYscopePioOutput::sliceAttach(paintSliceIsr);	//Low priority software interrupt that paints the slices
+		}
+	#endif
 }
 
 void XYscope::dacHandler(void) {
@@ -2444,53 +4059,45 @@ void XYscope::dacHandler(void) {
 	//	20170405 Ver 0.1	E.Andrews	Reworked to play nicely with timer driven refresh inteerupt
 	//	20170526 Ver 0.2	E.Andrews	Cleaned up comments and throw out unused code fragments
 	//	20180425 Ver 1.0	E.Andrews	Now routine does EndOfTransfer for both DUE and TEENSY 3.6
+	//	20261017 Ver 1.1				Chain the next paint run (visible segment) at ENDTX instead of blanking
+	//	20261017 Ver 1.2				DACC register access moved to DueDmaOutput (XYscopeBackend.h)
+	//	20261017 Ver 1.3				Keeps the PDC next buffer (TNPR/TNCR) loaded from ENDTX; the back porch is
+	//									DMA'ed points and the end of the paint is the TXBUFE interrupt (no NOP wait)
 	//
 	#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE
 		//----------------------------------------------------    
 		//  DUE END_OF_TRANSFER CODE BLOCK
 		//----------------------------------------------------
 
-		//Retrieve DACC interrupt status
-		uint32_t status = dacc_get_interrupt_status(DACC);
-
-		if ((status & DACC_ISR_ENDTX) == DACC_ISR_ENDTX) {//Verify we have a true ENDTX interrupt event.
-			//digitalWrite(CFG_Z_blank_pin,HIGH);	//turnoff crt beam
-
-			//digitalWrite(CFG_Z_blank_pin,LOW);	//Keep Beam On a little while longer...
-			//digitalWrite(CFG_Z_blank_pin,LOW);	//Keep Beam On a little while longer...
-			//digitalWrite(CFG_Z_blank_pin,LOW);	//Keep Beam On a little while longer...
-			//digitalWrite(CFG_Z_blank_pin,HIGH);	//turnoff crt beam
-			///digitalWrite(CFG_Z_blank_pin,LOW);	//turnoff crt beam}
-			///digitalWrite(CFG_Z_blank_pin,HIGH);	//turnoff crt beam}
-			///digitalWrite(CFG_Z_blank_pin,LOW);	//turnoff crt beam}
-			///digitalWrite(CFG_Z_blank_pin,LOW);	//turnoff crt beam}
-
-			dacc_disable_interrupt(DACC, DACC_IER_ENDTX);//disable interrupt.  ENDTX = Interrupt at End_of_Transmit_Buffer event														//Skip this code and do nothing if not a ENDTX event
-			//ENDTX = End of Transmit Buffer.  ENDTX is set when DACC_TCR = 0.
-			//This statis check is insurance to be sure it is safe to start updating DMA registers
-			//This interlocks with ENDTX status bit so that we only change and update the DMA registers inbetween active DMA transfers.
-			// //digitalWrite(CFG_Z_blank_pin,HIGH);	//Reset External Sync Signal
-			//Update CURRENT REGISTER SET to get it ready for next DMA Operation
-			// //DACC->DACC_TPR = (uint32_t)XYlist;		//(DACC_TPR) = Transmit (source data) Pointer Register
-			//Set this register to the starting address of the XYList[] array)
-			// //DACC->DACC_TCR = XYlistEnd;				//(DACC_TCR)= Transmit Counter Register. Loading this value initiates the start of a transfer
-			//The TCR should be set to number of integers we want to happen for each DMA transfer.
-			//In this case, XYlistEnd is always pointing at the last element of array XYlist[].	
-			//So...Set this TCR register = XYlistEnd counter value
-
-			//NVIC_DisableIRQ(DACC_IRQn);			//Disable DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
-			//NVIC_ClearPendingIRQ(DACC_IRQn);	//Clear any pending DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
-			//NVIC_EnableIRQ(DACC_IRQn);			//Now, ENABLE DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
-			//dacc_enable_interrupt(DACC, DACC_IER_ENDTX);	//Enable DAC interrupt.
-			//dacc_enable_interrupt(DACC, DACC_IER_TXBUFE);	//Enable DAC interrupt. DACC_IER_TXBUFE = Interrupt at End_of_Transmit_Buffer_EMPTY event
+		const pointList *chunk;
+		uint16_t points;
 
+		if (_dmaStage == DmaDraining) {
+			//Last chunk (the back porch) was queued; wait for the PDC to empty both buffers
+			if (!DueDmaOutput::allSent()) return;
+			DueDmaOutput::disableEmptyInterrupt();
+			DueDmaOutput::blank();	//BLANK display...Back porch has been sent...
+			autoSetRefreshTime();	//Adjust refresh time as needed...
+			_paintActive = false;
+			return;
 		}
-		autoSetRefreshTime();	//Adjust refresh time as needed...
-		for (int i = backPorchBlankCount; i > 0; i--) {
-			__asm__ __volatile__("nop");
-			//loop to generate a short (~60ns per count), programmable delays
+		if (!DueDmaOutput::endOfTransfer()) return;	//Verify we have a true ENDTX interrupt event (current buffer done, next one now active)
+
+		if (_dmaStage == DmaFrontPorch) {
+			//Front porch points are out; the DACs are on the first point of the frame
+			if (millis() > _crtOffTOD_ms && _screenOnTime_ms != 0) {
+				DueDmaOutput::blank();	//Keep BLANKED if ScreenSave Time Not yet Exceeded
+			} else	DueDmaOutput::unblank();	//Unblank and resume display
+			_dmaStage = DmaPainting;
+		}
+		if (dmaNextChunk(chunk, points, DmaChunkMax)) {
+			DueDmaOutput::queueNext(chunk, points * 2);	//Loading TNCR clears ENDTX; PDC moves on to it without a gap
+		} else {
+			//Nothing left to queue; finish when the buffer that is now active has been sent
+			DueDmaOutput::disableEndInterrupt();
+			DueDmaOutput::enableEmptyInterrupt();
+			_dmaStage = DmaDraining;
 		}
-		digitalWrite(CFG_Z_blank_pin, HIGH);	//BLANK display...Last point has been plotted...
 	#endif	//End Arduino DUE code block
 	
 }
@@ -2516,50 +4123,370 @@ void XYscope::initiateDacDma(void) {
 	//	20170724 Ver 0.1	E.Andrews	Reworked to automatically adjust FRONT PORCH blanking signal
 	//									based on active DMA clock rate.
 	//	20180425 Ver 1.0	E.Andrews	Now routine does EndOfTransfer for both DUE and TEENSY 3.6
+	//	20261017 Ver 1.1				Paint all runs (XY_List + visible segments); dacHandler chains runs 2..n
+	//	20261017 Ver 1.2				DACC/PDC register access moved to DueDmaOutput (XYscopeBackend.h)
+	//	20261017 Ver 1.3				Front porch is a short first DMA chunk (no NOP wait); the next chunk is
+	//									queued in TNPR/TNCR before the transfer starts
 	//
 	#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE
 		//----------------------------------------------------    
 		//  DUE CODE BLOCK
 		//----------------------------------------------------
 
-		DACC->DACC_TPR = (uint32_t) XY_List;//(DACC_TPR) = Transmit (source data) Pointer Register
-		//DACC->DACC_TNPR = (uint32_t)XY_List;	//(DACC_TNPR) Transmit NEXT Pointer register. <--May not be needed...
-		//Set this register to the starting address of the XY_List[] array)
+		const pointList *chunk;
+		uint16_t points;
 
-		DACC->DACC_TCR = XYlistEnd * 2;	//(DACC_TCR)= Transmit Count Register (TCR=How many Short-Integers to transfer).
-										//Set TCR register = XYlistEnd counter value
-		DACC->DACC_TNCR = 0;//(DACC_TNCR)= Transmit NEXT Counter Register is NOT USED; set to zero!. <--May not be needed...
-		//DACC->DACC_TNCR = XYlistEnd*2;		//(DACC_TNCR)= Transmit NEXT Counter Register. <--May not be needed...
-		//The TCR should be set to number of integers we want to happen for each DMA transfer.
-		//In this case, XYlistEnd is always pointing at the last element of array XY_List[].	
+		paintListSwap();	//Select the list to paint (picks up a committed list when double buffered)
+		_dmaRun = 0;		//Start with the first run; dacHandler queues the rest (more chunks, visible segments)
+		_dmaPos = 0;
+		_dmaPadPoints = 0;
+		DueDmaOutput::blank();	//Stay blanked during the front porch...
 
-		//This is how we START a transfer! (This will actually start the DMA transfer
-		DACC->DACC_PTCR = DACC_PTCR_TXTEN;//(DACC_PTCR) = Receiver Transfer Enable Register  
+		//The FRONT PORCH is the first points of the frame, sent blanked: ENDTX of this short first chunk is when
+		//the data is at DAC0/DAC1 and dacHandler unblanks.  No CPU time is spent waiting.
+		if (!dmaNextChunk(chunk, points, max(dmaPorchPoints(frontPorchBlankCount), (uint16_t) 1))) {
+			autoSetRefreshTime();	//Nothing to paint
+			return;
+		}
+		_dmaPadPoints = min(dmaPorchPoints(backPorchBlankCount), (uint16_t) DmaPorchPadMax);	//BACK PORCH: last point, repeated
+		_dmaStage = DmaFrontPorch;
+		_paintActive = true;
+		DueDmaOutput::startRun(chunk, points * 2);	//TCR=How many Short-Integers to transfer
+		if (dmaNextChunk(chunk, points, DmaChunkMax)) DueDmaOutput::queueNext(chunk, points * 2);
+		DueDmaOutput::enableEndInterrupt(); //Interrupt when the current buffer is done (next one is loaded there)
+		DueDmaOutput::go();
+	#endif	//End Arduino DUE code block	
+}
+bool XYscope::dmaNextChunk(const pointList *&chunk, uint16_t &points, int maxPoints) {
+	//
+	//	DUE DMA helper: Hands out the frame in pieces the PDC can take (up to maxPoints, never more than its
+	//	16 bit counter holds), walking the paint runs (XY_List + visible segments) from _dmaRun/_dmaPos.
+	//	After the last point of the last run it returns the back porch once: _dmaPadPoints copies of that
+	//	last point, so the beam sits still while the DACC works through its FIFO before dacHandler blanks.
+	//
+	//	Calling parameters:
+	//		chunk		Set to the first point of the piece
+	//		points		Set to how many points the piece has
+	//		maxPoints	Most points wanted
+	//
+	//	Returns:	true if a piece was handed out, false when the frame (and back porch) is done.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	while (_dmaRun < _paintRunCount) {
+		int left = _paintRuns[_dmaRun].end - _dmaPos;
+		if (left > 0) {
+			chunk = _paintRuns[_dmaRun].list + _dmaPos;
+			points = min(left, min(maxPoints, int(DmaChunkMax)));
+			_dmaPos += points;
+			_dmaPorchPad[0] = chunk[points - 1];	//Remember the last point sent (back porch)
+			return true;
+		}
+		_dmaRun++;		//Run done (or empty)...On to the next one
+		_dmaPos = 0;
+	}
+	if (_dmaPadPoints == 0) return false;
+	for (int i = 1; i < _dmaPadPoints; i++) _dmaPorchPad[i] = _dmaPorchPad[0];
+	chunk = _dmaPorchPad;
+	points = _dmaPadPoints;
+	_dmaPadPoints = 0;
+	return true;
+}
 
-		//Now that DMA transfer is under way, we must UNBLANK the Z-Axis by setting the Blanking Pin LOW.
+uint16_t XYscope::dmaPorchPoints(uint16_t porchCount) {
+	//
+	//	DUE DMA helper: Converts a porch blank count (front/backPorchBlankCount, ~60ns per count as the NOP
+	//	delays they used to time) to the number of whole DMA points (2 transfers each) that take as long.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	float pointNs = DmaClkPeriod_us * 2000.;
+	if (porchCount == 0 || pointNs <= 0) return 0;
+	return uint16_t(porchCount * 60. / pointNs + .999);
+}
+template <class Out> inline void XYscope::pioSettleAndUnblank(bool LongSettle){
+	//
+	//	PIO refresh helper: Waits for the DACs to settle on the point just written, then pulses the beam ON
+	//	(unblanks) for that point.  Used by pioPaint() for every point it paints, whether it comes from the
+	//	XY_List, a segment, or the primitive display list.
+	//
+	//	Calling parameters:
+	//		Out			Output backend (template parameter, see XYscopeBackend.h)
+	//		LongSettle	true if the point is a Large Step (more than NoSettlingTimeReqd) from the prior point.
+	//					Large steps get more settling time.
+	//
+	//	Note: The order of the statements within the refresh loop has been optimized to 
+	//  get data to the DACs as fast as possible... In fact, it may may still be TOO FAST
+	//	at some CPU over rates and/or when using slow oscilloscopes. Settling Time, Step Limit,
+	//	and unblank times can be set within XYscopeConfig.h (in ns, the same for every CPU speed) to
+	//	accommodate scope, plot quality, & total number of points you need to plot without flicker.
+	//	The config variables to look for and adjust inside of XYscopeConfig.h are:
+	//------------------------------------
+	//	#define CFG_PioSmallSettleNs 270	//Small Step SETTLING TIME delay (ns)
+	//	#define CFG_PioLargeSettleNs 500	//Large Step SETTLING TIME delay (ns)
+	//	#define CFG_PioUnblankNs 70			//UNBLANK pulse width delay (ns)
+	//	#define CFG_NoSettlingTimeReqd 1000	//Large Step Breakpoint LIMIT (in DAC counts)
+	//------------------------------------
+	//	(The sketch may also change PioSmallSettleNs, PioLargeSettleNs & PioUnblankNs at run time.)
+	//
+	//	20261017 Ver 0.0	Pulled out of the PIO refresh loops (no change in timing sequence)
+	//	20261017 Ver 0.1	Takes the Large/Small step decision (SettleLong_flag) instead of the step size
+	//	20261017 Ver 0.2	Output goes through the backend (Out::delayNops, Out::unblank, Out::blank)
+	//	20261017 Ver 0.3	Delays are CPU cycles timed by the cycle counter (Out::delayCycles) instead of NOP loops
+	//
+
+	//Insert More "BlankOutput" statements to extend DAC settling time if big setps are made.
+	//Note: This may be needed for slow scopes or when running CPU at high CPU over-clock rates.
+	if (LongSettle){	//change settling time based on Large or Small step size change
+		Out::delayCycles(_largeSettleCycles);	//Large Step SETTLING TIME DELAY
+	}else{
+		Out::delayCycles(_smallSettleCycles);	//Small Step SETTLING TIME DELEY
+	}
+	noInterrupts();		//Unblank(X,Y) n-1 point (Give the DACs as much settling time as possible		
+		Out::unblank();	//Have at least one UNBLANK pulse!
+		Out::delayCycles(_unblankCycles);
+		Out::blank();	//Now turn the spot off!
+	interrupts();	
+}
 
-		//The following repeated digitalWrites are used as fixed delays to properly time the
-		//state change of the crtBlanking signal which is used by the hardware interface &
-		//to properly unblank the output once actual data is starting to appear at DAC1/DAC2
+template <class Out> void XYscope::pioPaint(void){
+	//
+	//	PIO refresh loop: Sends the XY_List, each visible segment, and then the rasterized primitive display
+	//	list to the DACs one point at a time, unblanking the beam for each point.  Also records the refresh
+	//	metrics and auto-adjusts the refresh period.
+	//
+	//	Calling parameters:
+	//		Out		Output backend (template parameter, see XYscopeBackend.h)
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	Merged from the TEENSY 3.6 (initiatePioScreenPaint) and DUE (initiateDuePioScreenPaint)
+	//						PIO paint loops, which only differed in how the DACs were written
+	//	20261017 Ver 0.1	Level Of Detail: runs (and primitives) thinned by the current LOD level paint every Nth point
+	//	20261017 Ver 0.2	Corrects the paint time cost model gain from the measured paint time
+	//	20261017 Ver 0.3	Split into pioPaintStart/pioPaintSlice/pioPaintFinish so the paint can also be done in
+	//						slices (CFG_SlicedPaint); here the whole frame is painted as one slice
+	//
+	pioPaintStart<Out>();
+	pioPaintSlice<Out>(0xffffffff);
+	pioPaintFinish<Out>();
+}
 
-		digitalWrite(CFG_Z_blank_pin, HIGH);	//Stay blanked...
+template <class Out> void XYscope::pioPaintStart(void){
+	//
+	//	PIO paint, first step: Records the refresh interval metrics, selects the list to paint and rewinds
+	//	the paint state (_ps) for pioPaintSlice().
+	//
+	//	Calling parameters:
+	//		Out		Output backend (template parameter, see XYscopeBackend.h)
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	Pulled out of pioPaint(); also keeps the refresh jitter statistic (getRefreshJitterUs)
+	//	20261017 Ver 0.1	Converts the settle & unblank times (ns) to CPU cycles for this paint
+	//	20261017 Ver 0.2	Keeps this frame's jitter for its telemetry record
+	//	20261017 Ver 0.3	Host: also records the simulated start time
+	//
+	_ps.startMs=millis();
+	_ps.startUs=micros();
+	#if defined(XYSCOPE_HOST)
+		_ps.startSimUs=XYscopePioOutput::timeUs();
+	#endif
+	act_RefreshIntervalMs=_ps.startMs - act_PriorRefreshTimeStampMs;	//Calculate Last Refresh Time (ms) and save in global variable 
+	act_PriorRefreshTimeStampMs = _ps.startMs;							//Update last refresh time stamp
+	act_RefreshIntervalUs=_ps.startUs - act_PriorRefreshTimeStampUs;	//Calculate Last Refresh Time (ms) and save in global variable 
+	act_PriorRefreshTimeStampUs = _ps.startUs;							//Update last refresh time stamp
+	_frameJitterUs = 0;
+	if (_jitterExpectedUs > 0){	//Jitter: how far this interval was from the period in force when it started
+		uint32_t err = abs((long) act_RefreshIntervalUs - (long) _jitterExpectedUs);
+		if (err > _refreshJitterUs) _refreshJitterUs = err;
+		_frameJitterUs = err;
+	}
+	_jitterExpectedUs = ActiveRefreshPeriod_us;
+	paintListSwap();	//Select the list to paint (picks up a committed list when double buffered)
+	_smallSettleCycles = nsToCycles(PioSmallSettleNs);
+	_largeSettleCycles = nsToCycles(PioLargeSettleNs);
+	_unblankCycles = nsToCycles(PioUnblankNs);
+	Out::paintBegin();
+
+	_ps.run=0;
+	_ps.index=0;
+	_ps.priorX=0;
+	_ps.priorY=0;
+	_ps.longSettle=true;
+	_ps.pointWritten=false;
+	_ps.primStarted=false;
+	_ps.primSkip=0;
+	_ps.painted=0;
+	_primPointsPainted=0;
+	//	Implement Screen Saver check...Only write to screen if not in screen_save
+	_ps.screenSaved = millis() > _crtOffTOD_ms && _screenOnTime_ms != 0;
+	if (_ps.screenSaved) {
+		Out::blank();	// We are in screen_save mode - Keep CRT BLANKED and DO NOT paint the screen.
+	}
+}
 
-		for (int i = frontPorchBlankCount; i > 0; i--) {
-			__asm__ __volatile__("nop");
-			//loop to generate a short (~60ns per count), programmable delays
+template <class Out> bool XYscope::pioPaintSlice(uint32_t maxPoints){
+	//
+	//	PIO paint, second step: Paints up to maxPoints more points of the frame started by pioPaintStart(),
+	//	picking up where the previous slice stopped (runs first, then the primitive display list).
+	//
+	//	Calling parameters:
+	//		Out			Output backend (template parameter, see XYscopeBackend.h)
+	//		maxPoints	Most points to paint in this slice (0xffffffff = the whole frame)
+	//
+	//	Returns:	true when the frame is done (last point unblanked), false if there is more to paint
+	//
+	//	20261017 Ver 0.0	Paint loops pulled out of pioPaint() and made resumable (state in _ps)
+	//
+	int i, pEnd, stop, stride;
+	uint8_t shift;
+	uint32_t left=maxPoints;
+	pointList *pList;
+	short X, Y;
+	short Prior_X=_ps.priorX, Prior_Y=_ps.priorY;
+	bool LongSettle=_ps.longSettle;
+
+	if (_ps.screenSaved) return true;
+
+	//Paint the base list followed by each visible segment, in order (see paintListSwap)
+	for (;_ps.run<_paintRunCount;_ps.run++,_ps.index=0){
+		pList=_paintRuns[_ps.run].list;
+		pEnd=_paintRuns[_ps.run].end;
+		if (pEnd<=0) continue;
+		shift=lodShift(_lodLevel, _paintRuns[_ps.run].priority);
+		stride=1<<shift;
+		if (_ps.index==0){
+			if (left==0) break;
+			//First point of a run follows whatever was painted before it, so its step size is worked out here...
+			X=pList[0].X & 0xfff;
+			Y=pList[0].Y & 0xfff;
+			if (_ps.pointWritten) pioSettleAndUnblank<Out>(LongSettle);	//Show (X,Y) n-1 point
+			Out::writeXY(X, Y);
+			LongSettle = !_ps.pointWritten || max( abs(X-Prior_X), abs(Y-Prior_Y) ) >NoSettlingTimeReqd;	//First point always gets the Large Step settling time
+			_ps.pointWritten=true;
+			Prior_X=X;
+			Prior_Y=Y;
+			_ps.index=stride;
+			_ps.painted++;
+			left--;
 		}
+		if (shift==0){
+			//...the rest were tagged with SettleLong_flag when they were plotted (see settleAnnotate)
+			stop = (uint32_t) (pEnd-_ps.index) > left ? _ps.index+left : pEnd;
+			for (i=_ps.index;i<stop;i++){
+				pioSettleAndUnblank<Out>(LongSettle);	//Show (X,Y) n-1 point
 
-		if (millis() > _crtOffTOD_ms && _screenOnTime_ms != 0) {
-			digitalWrite(CFG_Z_blank_pin, HIGH);	//Keep BLANKED if ScreenSave Time Not yet Exceeded
-		} else	digitalWrite(CFG_Z_blank_pin, LOW);	//Unblank and resume display
+				//Now update DAC's with (X,Y) n point.
+				Out::writeXY(pList[i].X & 0xfff, pList[i].Y & 0xfff);
+				LongSettle = pList[i].X & SettleLong_flag;	//Settling time class for this point
+			}
+			if (stop>_ps.index){
+				_ps.painted+=stop-_ps.index;
+				left-=stop-_ps.index;
+				Prior_X=pList[stop-1].X & 0xfff;	//Capture last X value so that next point plotted can be evaluated
+				Prior_Y=pList[stop-1].Y & 0xfff;	//Capture last Y value so that next point plotted can be evaluated
+				_ps.index=stop;
+			}
+		} else {
+			//...thinned by LOD: paint every stride'th point.  The tags are for the step from the point just before, so work it out here
+			for (i=_ps.index;i<pEnd && left>0;i+=stride){
+				pioSettleAndUnblank<Out>(LongSettle);	//Show (X,Y) n-1 point
+				X=pList[i].X & 0xfff;
+				Y=pList[i].Y & 0xfff;
+				Out::writeXY(X, Y);
+				LongSettle = max( abs(X-Prior_X), abs(Y-Prior_Y) ) >NoSettlingTimeReqd;
+				Prior_X=X;
+				Prior_Y=Y;
+				_ps.painted++;
+				left--;
+			}
+			_ps.index=i;
+		}
+		if (_ps.index<pEnd) break;	//Out of points for this slice
+	}
 
-		dacc_enable_interrupt(DACC, DACC_IER_ENDTX); //Enable interrupt when dac runs out of data...
-	#endif	//End Arduino DUE code block	
+	if (_ps.run>=_paintRunCount && left>0){
+		//Then rasterize the primitive display list (if any) right into the DACs
+		if (_primCount>0){
+			if (!_ps.primStarted){
+				primRasterStart();
+				_ps.primStarted=true;
+			}
+			stride=(1<<lodShift(_lodLevel, 0))-1;	//LOD: Skip this many rasterized points after each one painted
+			i=_ps.primSkip;
+			while (left>0 && primNextPoint(X,Y)){
+				_primPointsPainted++;
+				if (i-- > 0) continue;
+				i=stride;
+				if (_ps.pointWritten) pioSettleAndUnblank<Out>(LongSettle);	//Show (X,Y) n-1 point
+				X &= 0xfff;
+				Y &= 0xfff;
+				Out::writeXY(X, Y);
+				LongSettle = !_ps.pointWritten || max( abs(X-Prior_X), abs(Y-Prior_Y) ) >NoSettlingTimeReqd;	//Primitives are rasterized on the fly, so no tag
+				Prior_X=X;
+				Prior_Y=Y;
+				_ps.pointWritten=true;
+				_ps.painted++;
+				left--;
+			}
+			_ps.primSkip=i;
+		}
+		if (left>0){
+			if (_ps.pointWritten) pioSettleAndUnblank<Out>(LongSettle);	//Show the very last point
+			return true;
+		}
+	}
+	_ps.priorX=Prior_X;
+	_ps.priorY=Prior_Y;
+	_ps.longSettle=LongSettle;
+	return false;
 }
+
+template <class Out> void XYscope::pioPaintFinish(void){
+	//
+	//	PIO paint, last step: Records the paint time metrics, corrects the paint time cost model and
+	//	auto-adjusts the refresh period.
+	//
+	//	Calling parameters:
+	//		Out		Output backend (template parameter, see XYscopeBackend.h)
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	Pulled out of pioPaint()
+	//	20261017 Ver 0.1	Adds the frame to the telemetry ring; act_NumPointsPlotted is now kept up to date
+	//	20261017 Ver 0.2	Host: times the paint in simulated time
+	//
+	uint32_t painted=_ps.painted;
+
+	act_PaintTimeDurationMs = millis()-_ps.startMs;	//Record metric of actual time spent doing PIO to screen
+	act_PaintTimeDurationUs = micros()-_ps.startUs;	//Record metric of actual time spent doing PIO to screen
+	measured_PaintTimeUs=micros()-_ps.startUs;		//Measure and save the actual refresh time. This global 
+													//variable is used by autoSetRefreshTime to make timer adjustments
+	#if defined(XYSCOPE_HOST)
+		//Host: the paint is timed in simulated TEENSY time, which is what the cost model predicts
+		act_PaintTimeDurationUs = measured_PaintTimeUs = XYscopePioOutput::timeUs()-_ps.startSimUs;
+	#endif
+	act_NumPointsPlotted=painted;
+	_lodPointsPainted=painted;
+	_lodPointsDropped=painted ? _paintPointCount+_primPointsPainted-painted : 0;	//Nothing painted = screen saver
+	frameRecordAdd(painted, painted ? _paintLargeCount+_primCount : 0);
+
+	//Correct the paint time cost model: move the gain 1/4 of the way to measured/modeled (limited to 1/4..4)
+	uint32_t modeledUs=paintCostUs(painted, _paintLargeCount+_primCount, 65536);
+	if (modeledUs >= 50){
+		int32_t ratio=min(max(((int64_t) measured_PaintTimeUs<<16)/modeledUs, (int64_t) 16384), (int64_t) 262144);
+		_costGainQ16+=(ratio-(int32_t) _costGainQ16)/4;
+	}
+	//Update and autoadjust the refresh time as needed...
+	autoSetRefreshTime();
+}
+
 void XYscope::initiatePioScreenPaint(void){
 	//
 	//	This routine will initiate a PIO data transfer of the current XYlist of points to DAC0 (X) & DAC1 (Y)
-	//	causing the points to "paint" onto the CRT screen.  This is a TEENSY 3.6 ONLY routine.
+	//	causing the points to "paint" onto the CRT screen.  This is a TEENSY 3.6 ONLY routine (and the paint
+	//	routine of the host simulation build).
 	//
 	//	An interrupt timer (TEENSY_3_6: "RefreshTimer") is used to trigger this routine every 'refreshPeriodMs'.
 	//	Usually refreshPeriodMs is a constant(defined in XYscopeConfig.h) that is normally set to a value in the 
@@ -2578,100 +4505,148 @@ void XYscope::initiatePioScreenPaint(void){
 	//									consumes 100% of the currently defined refresh period.
 	// 
 	//  20180520 Ver 1.1	E.Andrews	Add programmable Large Set LIMIT value and Small-Step DAC settling Time	
-	#if defined (__MK66FX1M0__)	//Only compile this code block for TEENSY 3.6
-		//----------------------------------------------------    
-		//  TEENSY 3.6 CODE BLOCK
-		//----------------------------------------------------	
-		
-		int i=0;
-		short Prior_X=0,Prior_Y=0,StepSize=4000;
-		long startTimeStampMs, startTimeStampUs;
-
-		uint8_t SettleLoopCount=0, UnblankLoopCount=0;
-		startTimeStampMs=millis();
-		startTimeStampUs=micros();
-		//Implement ScreenSaver function...
-		act_RefreshIntervalMs=startTimeStampMs - act_PriorRefreshTimeStampMs;	//Calculate Last Refresh Time (ms) and save in global variable 
-		act_PriorRefreshTimeStampMs = startTimeStampMs;							//Update last refresh time stamp
-		act_RefreshIntervalUs=startTimeStampUs - act_PriorRefreshTimeStampUs;	//Calculate Last Refresh Time (ms) and save in global variable 
-		act_PriorRefreshTimeStampUs = startTimeStampUs;							//Update last refresh time stamp
-		
-		//	Implement Screen Saver check...Only write to screen if not in screen_save
-		if (millis() > _crtOffTOD_ms && _screenOnTime_ms != 0) {
-			BlankOutput;	// We are in screen_save mode - Keep CRT BLANKED and DO NOT paint the screen, just return.
+	//	20261017 Ver 1.2				Paint the XY_List followed by each visible segment (run list from paintListSwap)
+	//	20261017 Ver 1.3				Settle/unblank moved to pioSettleAndUnblank(); rasterize primitive display list after the runs
+	//	20261017 Ver 1.4				List points carry their settling time class (SettleLong_flag, set by settleAnnotate)
+	//									so no step size math is done per point; X/Y masked to 12 bits for the DACs
+	//	20261017 Ver 1.5				Loop moved to pioPaint() (shared with DUE); DAC & blanking writes go through the backend
+	//	20261017 Ver 1.6				CFG_SlicedPaint: only starts the frame; paintSliceIsr() paints it in slices of
+	//									about CFG_PaintSliceUs from a low priority software interrupt
+	//	20261017 Ver 1.7				CFG_TnsyDmaPaint: fills the DMA sample ring & starts the PDB; dmaHalfIsr() does the rest
+	#if defined (__MK66FX1M0__) || defined(XYSCOPE_HOST)	//Only compile this code block for TEENSY 3.6 (or host simulation)
+		if (CFG_TnsyDmaPaint) {
+			if (_paintActive) return;	//Last frame still being sent (refresh period too short): skip this refresh
+			pioPaintStart<DmaSchedule>();
+			if (_ps.screenSaved) {
+				XYscopePioOutput::blank();
+				pioPaintFinish<DmaSchedule>();
+				return;
+			}
+			_dmaDrain = 0;
+			dmaFillHalf(0);
+			dmaFillHalf(1);
+			_paintActive = true;
+			XYscopeDmaOutput::start(CFG_TnsyDmaSampleNs);
+			return;
 		}
-		else	{	//Not in screen save...Implement PIO refresh cycle
-			
-			//Init First Two Points
-			*(int16_t *)&(DAC0_DAT0L)=XY_List[i].X;	//Send X value to DAC0
-			*(int16_t *)&(DAC1_DAT0L)=XY_List[i].Y;	//Send Y value to DAC1
-			i=1;
+		if (!CFG_SlicedPaint) {
+			pioPaint<XYscopePioOutput>();
+			if ((uint32_t) act_PaintTimeDurationUs > _sliceMaxUs) _sliceMaxUs = act_PaintTimeDurationUs;	//The whole paint is one slice
+			return;
+		}
+		if (_psActive) return;	//Last frame still painting (refresh period too short): skip this refresh
+		pioPaintStart<XYscopePioOutput>();
+		//Points per slice from the cost model: about CFG_PaintSliceUs worth of this frame's average point
+		uint32_t n = max(_paintPointCount+_primCount, (uint32_t) 1);
+		uint32_t frameUs = max(paintCostUs(n, _paintLargeCount+_primCount, _costGainQ16), (uint32_t) 1);
+		_slicePoints = max((uint32_t) (((uint64_t) CFG_PaintSliceUs * n) / frameUs), (uint32_t) 16);
+		_psActive = true;
+		XYscopePioOutput::slicePend();
+	#endif
+}
 
+void XYscope::dmaHalfIsr(void){
+	//	TEENSY eDMA + PDB paint (CFG_TnsyDmaPaint, see XYscopeBackend.h TeensyDmaOutput): called each time
+	//	half of the DMA sample ring has been sent.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_sliceOwner) _sliceOwner->dmaRefill(XYscopeDmaOutput::sentHalf());
+}
 
-			
+void XYscope::dmaRefill(uint8_t half){
+	//	Refills the half of the sample ring that was just sent (the DMA is now sending the other half), and
+	//	measures the time it took (getPaintSliceMaxUs; it must stay well under one half ring of samples).
+	//	Once the frame is done and an idle half has been sent after it, stops the DMA & finishes the frame.
+	//
+	//	Calling parameters:
+	//		half		Half of the ring just sent (0 or 1)
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	#if defined (__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		if (_dmaDrain >= 2) {
+			XYscopeDmaOutput::stop();
+			pioPaintFinish<DmaSchedule>();
+			_paintActive = false;
+			return;
+		}
+		uint32_t t0 = XYscopePioOutput::timeUs();
+		dmaFillHalf(half);
+		uint32_t fillUs = XYscopePioOutput::timeUs() - t0;
+		if (fillUs > _sliceMaxUs) _sliceMaxUs = fillUs;
+	#endif
+}
 
-			while (i<XYlistEnd+1){	//Actually, over-run array by one to be sure we see the last point
-				//Note: The order of the following statements within the refresh loop has been optimized to 
-				//  get data to the DACs as fast as possible... In fact, it may may still be TOO FAST
-				//	at some CPU over rates and/or when using slow oscilloscopes. Settling Time, Step Limit,
-				//	and unblank times can be set within XYscopeConfig.h for each CPU speed to accommodate
-				//	scope, plot quality, & total number of points you need to plot without flicker.
-				//	The config variables to look for and adjust inside of XYscopeConfig.h are:
-				//------------------------------------
-				//#if (F_CPU == 216000000)	//216 Mhz CPU Speed (A different setting is available for each CPU speed)
-				//	#define CFG_PioLargeSettleCount 40		//Large Step SETTLING TIME delay (where n=Num of NOP instructions)
-				//	#define CFG_PioUnblankCount 15		//UNBLANK pulse width delay (where n=Num of NOP instructions)
-				//	#define CFG_NoSettlingTimeReqd 5	//Large Step Breakpoint LIMIT (in DAC counts)
-				//#endif
-				//------------------------------------
-				//  Compare new (x,y) location with (prior_x,prior_Y) so see if step or small step is being taken
-				
-				
-				//Insert More "BlankOutput" statements to extend DAC settling time if big setps are made.
-				//Note: This may be needed for slow scopes or when running CPU at high CPU over-clock rates.
-				if (StepSize >NoSettlingTimeReqd){	//change settling time based on Large or Small step size change
-					for (SettleLoopCount=0;SettleLoopCount<PioLargeSettleCount;SettleLoopCount++){
-						__asm__ __volatile__("nop");	//Large Step SETTLING TIME DELAY
-						//BlankOutput;	//Extra delay before UNBLANK to give more DAC settling time
-					}
-				}else{
-					for (SettleLoopCount=0;SettleLoopCount<PioSmallSettleCount;SettleLoopCount++){
-						__asm__ __volatile__("nop");	//Small Step SETTLING TIME DELEY
-						//BlankOutput;	//Extra delay before UNBLANK to give more DAC settling time
-					}
+void XYscope::dmaFillHalf(uint8_t half){
+	//	Builds the next samples of the frame into one half of the DMA sample ring with the normal paint loop
+	//	(pioPaintSlice compiled for DmaSchedule), as many points at a time as surely fit, then pads the rest of
+	//	the half by holding the last point with the beam OFF.  After the last point a whole idle half is sent
+	//	so the DMA can be stopped while it sends samples that do nothing.
+	//
+	//	Calling parameters:
+	//		half		Half of the ring to fill (0 or 1)
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	#if defined (__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		DmaSchedule::begin(half);
+		if (_dmaDrain == 0) {
+			uint16_t pointTicks = DmaSchedule::ticks(max(_largeSettleCycles, _smallSettleCycles)) + DmaSchedule::ticks(_unblankCycles);
+			if (DmaSchedule::room() <= 2 * pointTicks) {	//Half ring too small for these delays: drop the rest of the frame
+				DmaSchedule::flush();
+				_dmaDrain = 1;
+			}
+			while (_dmaDrain == 0 && DmaSchedule::room() > 2 * pointTicks) {
+				//n points paint n+1 settle & unblank pulses at most, and the frame's end needs one more sample
+				if (pioPaintSlice<DmaSchedule>((DmaSchedule::room() - 1) / pointTicks - 1)) {
+					DmaSchedule::flush();
+					_dmaDrain = 1;
 				}
-				noInterrupts();		//Unblank(X,Y) n-1 point (Give the DACs as much settling time as possible		
-					UnblankOutput;	//Have at least one UNBLANK pulse!
-					for (UnblankLoopCount=0;UnblankLoopCount<PioUnblankCount;UnblankLoopCount++){
-						__asm__ __volatile__("nop");
-						//UnblankOutput;	//Make this as tight as possible for a controlled point duration	
-					}
-					BlankOutput;	//Now turn the spot off!
-				interrupts();	
-
-				//Now update DAC's with (X,Y) n point.
-				//Move X Data to DAC0	
-				*(int16_t *)&(DAC0_DAT0L)=XY_List[i].X;	//Send X value to DAC0
-				//Move Y Data to DAC1	
-				*(int16_t *)&(DAC1_DAT0L)=XY_List[i].Y;	//Send X value to DAC0	
-				Prior_X=XY_List[i-1].X;		//Capture current X value so that next point plotted can be evaluated
-				Prior_Y=XY_List[i-1].Y;		//Capture current Y value so that next point plotted can be evaluated
-				StepSize = max( abs(XY_List[i].X-Prior_X), abs(XY_List[i].Y-Prior_Y) );	//Get the biggest difference for next point to show
-				i++;	//Advance pointer to next coordinate
-			
 			}
+		} else {
+			_dmaDrain = 2;
+		}
+		DmaSchedule::pad();
+	#endif
+}
 
-		}	
-					
-			
-		
-		act_PaintTimeDurationMs = millis()-startTimeStampMs;	//Record metric of actual time spent doing PIO to screen
-		act_PaintTimeDurationUs = micros()-startTimeStampUs;	//Record metric of actual time spent doing PIO to screen
-		measured_PaintTimeUs=micros()-startTimeStampUs;			//Measure and save the actual refresh time. This global 
-																//variable is used by autoSetRefreshTime to make timer adjustments
-		//Update and autoadjust the refresh time as needed...
-		autoSetRefreshTime();
-		
+void XYscope::paintSliceIsr(void){
+	//	Sliced paint software interrupt (CFG_SlicedPaint, see XYscopeBackend.h sliceAttach): paints one slice
+	//	of the frame started by initiatePioScreenPaint().  Runs below the refresh timer & user interrupts.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (_sliceOwner) _sliceOwner->paintSlice();
+}
+
+void XYscope::paintSlice(void){
+	//	Paints one slice (_slicePoints points) and measures it (getPaintSliceMaxUs).  Finishes the frame when
+	//	it is done, or pends the software interrupt again for the next slice, which lets any interrupt that
+	//	became pending during this slice run first.
+	//
+	//	Calling parameters: NONE
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	#if defined (__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		if (!_psActive) return;
+		uint32_t t0 = XYscopePioOutput::timeUs();
+		bool done = pioPaintSlice<XYscopePioOutput>(_slicePoints);
+		uint32_t sliceUs = XYscopePioOutput::timeUs() - t0;
+		if (sliceUs > _sliceMaxUs) _sliceMaxUs = sliceUs;
+		if (done) {
+			pioPaintFinish<XYscopePioOutput>();
+			_psActive = false;
+		} else {
+			XYscopePioOutput::slicePend();
+		}
 	#endif
 }
 
@@ -2694,106 +4669,13 @@ void XYscope::initiateDuePioScreenPaint(void){
 	//	20180524 Ver 1.0	E.Andrews	.
 	// 
 	//  20180520 Ver 1.1	E.Andrews	Add programmable Large Set LIMIT value and Small-Step DAC settling Time	
+	//	20261017 Ver 1.2				Paint the XY_List followed by each visible segment (run list from paintListSwap)
+	//	20261017 Ver 1.3				Settle/unblank moved to pioSettleAndUnblank(); rasterize primitive display list after the runs
+	//	20261017 Ver 1.4				List points carry their settling time class (SettleLong_flag, set by settleAnnotate)
+	//									so no step size math is done per point; X/Y masked to 12 bits for the DACs
+	//	20261017 Ver 1.5				Loop moved to pioPaint() (shared with TEENSY); DAC & blanking writes go through the backend
 	#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE
-		//----------------------------------------------------    
-		//  DUE CODE BLOCK
-		//----------------------------------------------------	
-		
-		int i=0;
-		short Prior_X=0,Prior_Y=0,StepSize=4000;
-		long startTimeStampMs, startTimeStampUs;
-
-		uint8_t SettleLoopCount=0, UnblankLoopCount=0;
-		startTimeStampMs=millis();
-		startTimeStampUs=micros();
-		//Implement ScreenSaver function...
-		act_RefreshIntervalMs=startTimeStampMs - act_PriorRefreshTimeStampMs;	//Calculate Last Refresh Time (ms) and save in global variable 
-		act_PriorRefreshTimeStampMs = startTimeStampMs;							//Update last refresh time stamp
-		act_RefreshIntervalUs=startTimeStampUs - act_PriorRefreshTimeStampUs;	//Calculate Last Refresh Time (ms) and save in global variable 
-		act_PriorRefreshTimeStampUs = startTimeStampUs;							//Update last refresh time stamp
-		analogWriteResolution(12);	//Define 12 Bit DAC operating modes
-		//	Implement Screen Saver check...Only write to screen if not in screen_save
-		if (millis() > _crtOffTOD_ms && _screenOnTime_ms != 0) {
-			BlankOutput;	// We are in screen_save mode - Keep CRT BLANKED and DO NOT paint the screen, just return.
-		}
-		else	{	//Not in screen save...Implement PIO refresh cycle
-			
-			//Init First Two Points
-			//*(int16_t *)&(DAC0_DAT0L)=XY_List[i].X;	//Send X value to DAC0
-			//*(int16_t *)&(DAC1_DAT0L)=XY_List[i].Y;	//Send Y value to DAC1
-			analogWrite(CFG_Due_DAC0_pin,XY_List[i].X);
-			analogWrite(CFG_Due_DAC1_pin,XY_List[i].Y);
-			i=1;
-
-
-			
-
-			while (i<XYlistEnd+1){	//Actually, over-run array by one to be sure we see the last point
-				//Note: The order of the following statements within the refresh loop has been optimized to 
-				//  get data to the DACs as fast as possible... In fact, it may may still be TOO FAST
-				//	at some CPU over rates and/or when using slow oscilloscopes. Settling Time, Step Limit,
-				//	and unblank times can be set within XYscopeConfig.h for each CPU speed to accommodate
-				//	scope, plot quality, & total number of points you need to plot without flicker.
-				//	The config variables to look for and adjust inside of XYscopeConfig.h are:
-				//------------------------------------
-				//#if (F_CPU == 216000000)	//216 Mhz CPU Speed (A different setting is available for each CPU speed)
-				//	#define CFG_PioLargeSettleCount 40		//Large Step SETTLING TIME delay (where n=Num of NOP instructions)
-				//	#define CFG_PioUnblankCount 15		//UNBLANK pulse width delay (where n=Num of NOP instructions)
-				//	#define CFG_NoSettlingTimeReqd 5	//Large Step Breakpoint LIMIT (in DAC counts)
-				//#endif
-				//------------------------------------
-				//  Compare new (x,y) location with (prior_x,prior_Y) so see if step or small step is being taken
-				
-				
-				//Insert More "BlankOutput" statements to extend DAC settling time if big setps are made.
-				//Note: This may be needed for slow scopes or when running CPU at high CPU over-clock rates.
-				if (StepSize >NoSettlingTimeReqd){	//change settling time based on Large or Small step size change
-					for (SettleLoopCount=0;SettleLoopCount<PioLargeSettleCount;SettleLoopCount++){
-						__asm__ __volatile__("nop");	//Large Step SETTLING TIME DELAY
-						//BlankOutput;	//Extra delay before UNBLANK to give more DAC settling time
-					}
-				}else{
-					for (SettleLoopCount=0;SettleLoopCount<PioSmallSettleCount;SettleLoopCount++){
-						__asm__ __volatile__("nop");	//Small Step SETTLING TIME DELEY
-						//BlankOutput;	//Extra delay before UNBLANK to give more DAC settling time
-					}
-				}
-				noInterrupts();		//Unblank(X,Y) n-1 point (Give the DACs as much settling time as possible		
-					UnblankOutput;	//Have at least one UNBLANK pulse!
-					for (UnblankLoopCount=0;UnblankLoopCount<PioUnblankCount;UnblankLoopCount++){
-						__asm__ __volatile__("nop");
-						//UnblankOutput;	//Make this as tight as possible for a controlled point duration	
-					}
-					BlankOutput;	//Now turn the spot off!
-				interrupts();	
-
-				//Now update DAC's with (X,Y) n point.
-				//Move X Data to DAC0	
-				//*(int16_t *)&(DAC0_DAT0L)=XY_List[i].X;	//Send X value to DAC0
-				//Move Y Data to DAC1	
-				//*(int16_t *)&(DAC1_DAT0L)=XY_List[i].Y;	//Send X value to DAC0	
-				
-				analogWrite(CFG_Due_DAC0_pin,XY_List[i].X);
-				analogWrite(CFG_Due_DAC1_pin,XY_List[i].Y);
-				
-				Prior_X=XY_List[i-1].X;		//Capture current X value so that next point plotted can be evaluated
-				Prior_Y=XY_List[i-1].Y;		//Capture current Y value so that next point plotted can be evaluated
-				StepSize = max( abs(XY_List[i].X-Prior_X), abs(XY_List[i].Y-Prior_Y) );	//Get the biggest difference for next point to show
-				i++;	//Advance pointer to next coordinate
-			
-			}
-
-		}	
-					
-			
-		
-		act_PaintTimeDurationMs = millis()-startTimeStampMs;	//Record metric of actual time spent doing PIO to screen
-		act_PaintTimeDurationUs = micros()-startTimeStampUs;	//Record metric of actual time spent doing PIO to screen
-		measured_PaintTimeUs=micros()-startTimeStampUs;			//Measure and save the actual refresh time. This global 
-																//variable is used by autoSetRefreshTime to make timer adjustments
-		//Update and autoadjust the refresh time as needed...
-		autoSetRefreshTime();
-		
+		pioPaint<DuePioOutput>();
 	#endif
 }
 /* 
@@ -2838,7 +4720,7 @@ void XYscope::disableDac(void) {	//TODO REMOVE THIS ROUTINE!
 		//----------------------------------------------------    
 		//  DUE CODE BLOCK
 		//----------------------------------------------------
-		dacc_disable_interrupt(DACC, DACC_IER_ENDTX);
+		DueDmaOutput::disableEndInterrupt();
 	#endif	//End Arduino DUE code block
 }
 
@@ -2896,24 +4778,11 @@ void XYscope::setRefreshPeriodUs(uint32_t refresh_us) {
 	//
 	//	20170705 Ver 0.0	E.Andrews	First cut
 	//	20180425 Ver 1.0	E.Andrews	Now supports both DUE(DMA) and TEENSY 3.6 (PIO)
+	//	20261017 Ver 1.1				Timer update goes through the output backend
 	//
 	ActiveRefreshPeriod_us = refresh_us;//Store the value as the ActiveRefreshPeriod
 
-	#if defined(__SAM3X8E__)		//Use timer3 only when compiling for DUE board
-		//----------------------------------------------------    
-		//  DUE CODE BLOCK
-		//----------------------------------------------------	
-		Timer3.start(refresh_us);	//Set the refresh timer
-	#endif	
-	
-	#if defined(__MK66FX1M0__)	//Only compile this code block for TEENSY 3.6
-		//----------------------------------------------------    
-		//  TEENSY 3.6 CODE BLOCK
-		//----------------------------------------------------
-		ChangeTeensyRefreshInterval(refresh_us);			//Update Timer Period
-
-	#endif
-	
+	XYscopePioOutput::setRefreshPeriod(refresh_us);	//DUE: Timer3, TEENSY: ChangeTeensyRefreshInterval() in the sketch
 }
 long XYscope::getRefreshPeriodUs(void) {
 	//	Routine to Get the refresh timer.  User can call any time to change the refresh period.
@@ -2950,6 +4819,10 @@ void XYscope::autoSetRefreshTime(void) {
 	//
 	//	20170717 Ver 0.0	E.Andrews	First cut
 	//	20180425 Ver 2.0	E.Andrews	Now supports both DUE(DMA) and TEENSY(PIO) versions
+	//	20261017 Ver 2.1				Timer update goes through the output backend; host simulation uses the TEENSY timing
+	//	20261017 Ver 2.2				LOD mode (setLodRefreshUs) holds the LOD refresh period and thins the display instead
+	//	20261017 Ver 2.3				TEENSY: Uses the predicted paint time of the next frame (cost model) instead of the last
+	//									measured one; also called by plotEnd(), plotCommit() & segmentEnd()
 	//
 	
 	uint32_t crtRefreshTime_us, TimeReqdToPlotAllPoints_us;	
@@ -2958,18 +4831,28 @@ void XYscope::autoSetRefreshTime(void) {
 		//----------------------------------------------------    
 		//  DUE CODE BLOCK
 		//----------------------------------------------------	
-		TimeReqdToPlotAllPoints_us = int(DmaClkPeriod_us * 2 * (XYlistEnd + 20));
+		TimeReqdToPlotAllPoints_us = int(DmaClkPeriod_us * 2 * (_paintPointCount + 20));
 	#endif
 	
-	#if defined(__MK66FX1M0__)
+	#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
 		//----------------------------------------------------    
-		//  TEENSY 3.6  CODE BLOCK
+		//  TEENSY 3.6 (and HOST SIMULATION) CODE BLOCK
 		//----------------------------------------------------
 		//
 		//For TEENSY,point-plot-time is defined in XYscope.h file.
 		//Note, we add 'TNSY_3_6_MinComputeTimeUs' on top of actual refresh time to provide some minimum
 		//time for non-refresh, CPU calculation time!
-		TimeReqdToPlotAllPoints_us = measured_PaintTimeUs+TNSY_3_6_MinComputeTimeUs;	
+		//The paint time of the next frame is predicted from its points & Large Steps (see paintCostUs), so the
+		//period is right before a big new frame is painted instead of one paint after
+		uint32_t points[LodLowestPriority+1], largeSteps, n=0;
+		nextFrameCost(points, largeSteps);
+		for (uint8_t p=0;p<=LodLowestPriority;p++) n+=points[p];
+		predicted_PaintTimeUs = paintCostUs(n, largeSteps, _costGainQ16);
+		if (_lodRefreshUs > 0) {
+			//LOD: The next paint is thinned so it fits; only stretch the period if even LodMaxLevel does not fit
+			predicted_PaintTimeUs = lodSelect(points, largeSteps);
+		}
+		TimeReqdToPlotAllPoints_us = predicted_PaintTimeUs+TNSY_3_6_MinComputeTimeUs;	
 	#endif
 	
 	// Calculate the display time needed based on number of points in XYlist
@@ -2978,37 +4861,305 @@ void XYscope::autoSetRefreshTime(void) {
 	
 	//  Compare calculated TimeReqd.. to MinRefresh value as as spec'd in header file.
 	//  Pick which ever time is largest....
-	if (TimeReqdToPlotAllPoints_us > CFG_CrtMinRefresh_us) {
+	uint32_t minRefresh_us = _lodRefreshUs > 0 ? _lodRefreshUs : CFG_CrtMinRefresh_us;	//LOD: the LOD period replaces the minimum
+	if (TimeReqdToPlotAllPoints_us > minRefresh_us) {
 		crtRefreshTime_us = TimeReqdToPlotAllPoints_us;	//Set Refresh time = to minimum defined refresh time or that required to get all the points to the screen...
 	} else {
-		crtRefreshTime_us = CFG_CrtMinRefresh_us;//Min Refresh Time in microseconds...
+		crtRefreshTime_us = minRefresh_us;//Min Refresh Time in microseconds...
 	}
 
 	//	Now see if we need to actually change the refresh timer...
 	//  Only Update REFRESH timer period (microseconds) when new time <> currently active timer
 	if (ActiveRefreshPeriod_us != crtRefreshTime_us) {
-		#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE
-			//----------------------------------------------------    
-			//  DUE CODE BLOCK
-			//----------------------------------------------------
-			Timer3.start(crtRefreshTime_us);			//Update Timer Period
-		#endif
-		#if defined(__MK66FX1M0__)	//Only compile this code block for TEENSY 3.6
-			//----------------------------------------------------    
-			//  TEENSY 3.6 CODE BLOCK
-			//----------------------------------------------------
-			ChangeTeensyRefreshInterval(crtRefreshTime_us);			//Update Timer Period
-			//RefreshTimer.update(crtRefreshTime_us);			//TODO: Why doesn't this work?
-		#endif
+		XYscopePioOutput::setRefreshPeriod(crtRefreshTime_us);	//Update Timer Period (DUE: Timer3, TEENSY: sketch IntervalTimer)
 		ActiveRefreshPeriod_us = crtRefreshTime_us;	//Store new value "ActiveRefreshPeriod_us"
 	}
 
 }
 
+void XYscope::setLodRefreshUs(uint32_t refresh_us) {
+	//	Level Of Detail (LOD) mode.  Holds the refresh period at refresh_us.  When the display has too many points to
+	//	paint in that time (less TNSY_3_6_MinComputeTimeUs), the refresh routine paints only every 2nd, 4th or 8th
+	//	point of the runs with the highest segmentPriority() numbers first, then of the rest, instead of stretching
+	//	the refresh period and flickering.  The period is only stretched if even LodMaxLevel does not fit.
+	//
+	//	Calling parameters:
+	//		refresh_us	Refresh period to hold (us).  0 = LOD off: full detail, period stretched as needed (default)
+	//
+	//	Returns:	NOTHING
+	//	Note: TEENSY 3.6 (and host simulation) PIO refresh only.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	_lodRefreshUs = refresh_us;
+	if (refresh_us == 0) _lodLevel = 0;
+}
+
+uint8_t XYscope::getLodLevel(void) {
+	//	Returns the LOD level used for the next paint: 0 = every point painted ... LodMaxLevel = most thinned.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _lodLevel;
+}
+
+uint32_t XYscope::getLodPointsDropped(void) {
+	//	Returns the number of points (XY_List, segments & rasterized primitives) left out of the last paint by LOD.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _lodPointsDropped;
+}
+
 /****************************************************************************/
 /* Private Functions */
 /****************************************************************************/
 
+inline uint8_t XYscope::lodShift(uint8_t level, uint8_t priority) {
+	//LOD level 1 thins the lowest priority runs to every 2nd point, level 2 to every 4th (and the next priority
+	//to every 2nd), and so on; no run is thinned past every (1 << LodMaxStrideShift)th point
+	int shift = level + priority - LodLowestPriority;
+	return shift <= 0 ? 0 : min(shift, (int) LodMaxStrideShift);
+}
+
+uint32_t XYscope::lodSelect(uint32_t points[], uint32_t largeSteps) {
+	//	Picks the LOD level for the next paint: the lowest level whose predicted paint time fits the LOD refresh
+	//	period less TNSY_3_6_MinComputeTimeUs.  Going back DOWN a level needs 1/16 of the budget to spare, so the
+	//	level does not flip every paint.  Thinning keeps the jumps between figures, so Large Steps are not scaled.
+	//
+	//	Calling parameters:
+	//		points		Points of the next frame by LOD priority, largeSteps its Large Steps (from nextFrameCost)
+	//	Returns:	Predicted paint time (us) at the level picked
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	Predicts with the paint time cost model instead of scaling the last paint time
+	//
+	uint32_t budget = _lodRefreshUs > (uint32_t) TNSY_3_6_MinComputeTimeUs ? _lodRefreshUs - TNSY_3_6_MinComputeTimeUs : 0;
+	uint32_t predicted = 0;
+	uint8_t level;
+	for (level = 0; level <= LodMaxLevel; level++) {
+		uint32_t n = 0;
+		for (uint8_t p = 0; p <= LodLowestPriority; p++) n += points[p] >> lodShift(level, p);
+		predicted = paintCostUs(n, largeSteps, _costGainQ16);
+		if (predicted <= (level < _lodLevel ? budget - budget / 16 : budget)) break;
+	}
+	_lodLevel = min(level, uint8_t(LodMaxLevel));
+	return predicted;
+}
+
+void XYscope::nextFrameCost(uint32_t points[], uint32_t &largeSteps) {
+	//	Counts what the refresh routine will paint next: the committed (double buffered) or current XY_List, the
+	//	visible segments and, from the last paint, the rasterized primitives.  The first point of every run and
+	//	every primitive are counted as Large Steps.
+	//
+	//	Calling parameters:
+	//		points		Returns the points of each LOD priority (points[0..LodLowestPriority]; XY_List & primitives are 0)
+	//		largeSteps	Returns the number of Large Steps
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	int end;
+	uint32_t large;
+	if (CFG_DoubleBufferXYlist) {
+		end = _commitPending ? _pendingEnd : _paintEnd;
+		large = _commitPending ? _pendingLargeSteps : _paintLargeSteps;
+	} else if (_segActive >= 0) {
+		end = _segSavedEnd;
+		large = _segSavedLargeSteps;
+	} else {
+		end = XYlistEnd;
+		large = _buildLargeSteps;
+	}
+	for (uint8_t p = 0; p <= LodLowestPriority; p++) points[p] = 0;
+	points[0] = end + _primPointsPainted;
+	largeSteps = (end > 0 ? large + 1 : 0) + _primCount;
+	for (uint8_t k = 0; k < _segCount; k++) {
+		segmentInfo *s = &_seg[k];
+		if (s->visible && s->count > 0) {
+			points[s->priority] += s->count;
+			largeSteps += s->largeSteps + 1;
+		}
+	}
+}
+
+uint32_t XYscope::paintCostUs(uint32_t points, uint32_t largeSteps, uint32_t gainQ16) {
+	//	Paint time cost model: every point costs CFG_PioPointCycles plus its unblank pulse and Small Step settling
+	//	delay; a Large Step costs the difference between the Large & Small Step delays on top of that.
+	//	Delays (ns) are turned into CPU cycles as the paint does.  The sum (CPU cycles) is scaled by gainQ16 and turned into us.
+	//
+	//	Calling parameters:
+	//		points		Number of points painted
+	//		largeSteps	How many of them are Large Steps
+	//		gainQ16		Correction (Q16, 65536 = none); _costGainQ16 is corrected after every paint by pioPaint()
+	//	Returns:	Predicted paint time (us)
+	//
+	//	20261017 Ver 0.0	First cut
+	//	20261017 Ver 0.1	CFG_TnsyDmaPaint: counts DMA samples instead (delays rounded up to samples, plus the idle half)
+	//	20261017 Ver 0.2	Delays in ns (cycle counter timed) instead of NOP counts
+	//
+	uint32_t small = nsToCycles(PioSmallSettleNs), large = nsToCycles(PioLargeSettleNs), unblank = nsToCycles(PioUnblankNs);
+	#if defined (__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		if (CFG_TnsyDmaPaint) {
+			uint32_t smallTicks = DmaSchedule::ticks(small), largeTicks = DmaSchedule::ticks(large);
+			int64_t samples = (int64_t) points * (smallTicks + DmaSchedule::ticks(unblank))
+				+ (int64_t) largeSteps * ((int32_t) largeTicks - (int32_t) smallTicks) + 2 * DmaSchedule::HalfSamples;
+			if (samples < 0) samples = 0;
+			return (uint32_t) (((samples * DmaSchedule::sample_ps / 1000000) * gainQ16) >> 16);
+		}
+	#endif
+	int64_t cycles = (int64_t) points * (CFG_PioPointCycles + unblank + small)
+		+ (int64_t) largeSteps * ((int32_t) large - (int32_t) small);
+	if (cycles < 0) cycles = 0;
+	return (uint32_t) (((cycles * gainQ16) >> 16) / (F_CPU / 1000000));
+}
+
+float XYscope::getPaintCostGain(void) {
+	//	Returns the paint time cost model correction: measured / modeled paint time, averaged over the last few paints.
+	//	1.0 means CFG_PioPointCycles matches this board exactly.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _costGainQ16 / 65536.0f;
+}
+
+uint32_t XYscope::getPaintSliceMaxUs(void) {
+	//	Returns the longest paint slice measured (us) since begin() or resetPaintJitter().  With CFG_SlicedPaint
+	//	this is the longest any interrupt below the refresh timer but above CFG_PaintIrqPriority waits for the paint.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _sliceMaxUs;
+}
+
+uint32_t XYscope::getRefreshJitterUs(void) {
+	//	Returns the worst difference (us) between a measured refresh interval and the refresh period that was in
+	//	force when it started, since begin() or resetPaintJitter().  A skipped refresh shows up as a whole period.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _refreshJitterUs;
+}
+
+void XYscope::resetPaintJitter(void) {
+	//	Restarts the getPaintSliceMaxUs() & getRefreshJitterUs() worst case statistics.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	noInterrupts();
+	_sliceMaxUs = 0;
+	_refreshJitterUs = 0;
+	_jitterExpectedUs = 0;
+	interrupts();
+}
+
+void XYscope::frameRecordAdd(uint32_t painted, uint32_t largeSteps) {
+	//	Telemetry: writes the record of the frame pioPaintFinish() just finished over the oldest one in the ring.
+	//	Called from the paint (interrupt) with the paint time metrics already updated.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (CFG_TelemetryFrames == 0) return;
+	frameRecord &r = _frames[_frameNext];
+	r.startUs = _ps.startUs;
+	r.paintUs = act_PaintTimeDurationUs;
+	r.points = painted;
+	r.largeSteps = largeSteps;
+	r.refreshUs = _jitterExpectedUs;		//Period in force when this paint started (set by pioPaintStart)
+	r.jitterUs = _frameJitterUs;
+	r.overrun = r.paintUs >= r.refreshUs;	//The next refresh came (or was due) before this one was done
+	if (++_frameNext >= CFG_TelemetryFrames) _frameNext = 0;
+	if (_frameCount < CFG_TelemetryFrames) _frameCount++;
+}
+
+uint16_t XYscope::getFrameCount(void) {
+	//	Returns the number of frames held by the telemetry ring (0 to CFG_TelemetryFrames).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	return _frameCount;
+}
+
+bool XYscope::getFrameRecord(uint16_t age, frameRecord &rec) {
+	//	Copies the telemetry record of a frame: age 0 = the last frame painted, 1 = the one before, ...
+	//
+	//	Returns:	false (rec unchanged) if the ring does not hold a frame that old.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	bool held;
+	noInterrupts();		//Don't let a paint overwrite the record while it is copied
+		held = age < _frameCount;
+		if (held) rec = _frames[(_frameNext + FrameRingSize - 1 - age) % FrameRingSize];
+	interrupts();
+	return held;
+}
+
+void XYscope::getFrameStats(frameStats &stats, uint16_t window) {
+	//	Paint time & refresh jitter statistics over the last frames painted.  Percentiles are nearest rank: p95
+	//	is the smallest value at least 95% of the frames are at or below.  Frames without a known jitter (the first
+	//	after begin() or resetPaintJitter()) count as 0 jitter.
+	//
+	//	Calling parameters:
+	//		stats		Filled in (all 0 when no frame is held)
+	//		window		How many of the last frames (0 or more than held = all held)
+	//
+	//	Returns:	NOTHING
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	uint32_t paintUs[FrameRingSize], jitterUs[FrameRingSize];
+	uint16_t n, overruns = 0;
+
+	noInterrupts();		//Take a consistent copy; the paint adds records from its interrupt
+		n = window == 0 || window > _frameCount ? _frameCount : window;
+		for (uint16_t i = 0; i < n; i++) {
+			const frameRecord &r = _frames[(_frameNext + FrameRingSize - 1 - i) % FrameRingSize];
+			paintUs[i] = r.paintUs;
+			jitterUs[i] = r.jitterUs;
+			overruns += r.overrun;
+		}
+	interrupts();
+
+	stats.frames = n;
+	stats.overruns = overruns;
+	stats.paintP50Us = percentileUs(paintUs, n, 50);	//Sorts paintUs; the rest just index it
+	stats.paintP95Us = percentileUs(paintUs, n, 95);
+	stats.paintP99Us = percentileUs(paintUs, n, 99);
+	stats.paintMaxUs = percentileUs(paintUs, n, 100);
+	stats.jitterP50Us = percentileUs(jitterUs, n, 50);
+	stats.jitterP95Us = percentileUs(jitterUs, n, 95);
+	stats.jitterP99Us = percentileUs(jitterUs, n, 99);
+	stats.jitterMaxUs = percentileUs(jitterUs, n, 100);
+}
+
+uint32_t XYscope::percentileUs(uint32_t *v, uint16_t n, uint8_t pct) {
+	//	Telemetry helper: sorts v[0..n-1] (insertion sort; already sorted after the first call) and returns the
+	//	nearest rank pct percentile: the smallest value that at least pct% of the values are at or below.
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	if (n == 0) return 0;
+	for (uint16_t i = 1; i < n; i++) {
+		uint32_t x = v[i];
+		uint16_t j = i;
+		for (; j > 0 && v[j - 1] > x; j--) v[j] = v[j - 1];
+		v[j] = x;
+	}
+	uint16_t rank = ((uint32_t) pct * n + 99) / 100;	//1..n
+	return v[rank > 0 ? rank - 1 : 0];
+}
+
+void XYscope::resetTelemetry(void) {
+	//	Empties the telemetry ring (getFrameCount() = 0).
+	//
+	//	20261017 Ver 0.0	First cut
+	//
+	noInterrupts();
+	_frameNext = 0;
+	_frameCount = 0;
+	interrupts();
+}
+
 uint32_t XYscope::FreqToTimerTicks(uint32_t freqHz) {
 	#if defined(__SAM3X8E__)	//Only compile this code block for Arduino DUE
 		//----------------------------------------------------    
@@ -3016,6 +5167,7 @@ uint32_t XYscope::FreqToTimerTicks(uint32_t freqHz) {
 		//----------------------------------------------------
 		return VARIANT_MCK / 2UL / freqHz;//Converts frequency(Hz) into Timer Count values for TC programming
 	#else
+		(void) freqHz;
 		return 0;	//Return 0 if not DUE processor	
 	#endif
 }
@@ -3086,7 +5238,7 @@ void XYscope::begin(uint32_t dmaFreqHz) {
 		digitalWrite(CFG_Z_blank_pin, HIGH);	//At the start, set CRT output to BLANKED		
 		
 		// Perform Refresh Timer (Timer #3) Setup
-		Timer3.start(CFG_CrtMinRefresh_us);  //Time Period specified in us (microseconds)
+		DueDmaOutput::setRefreshPeriod(CFG_CrtMinRefresh_us);  //Time Period specified in us (microseconds)
 	#endif
 	
 	//------------------------------------------------------------
@@ -3101,8 +5253,7 @@ void XYscope::begin(uint32_t dmaFreqHz) {
 		//Serial.print ("\n  -> XYscope.BEGIN, starting: Teensy IntervalTimer Setup");
 		//IntervalTimer RefreshTimer;	//Create an instance of an IntervalTimer and call it 'RefreshTimer'.
 		//Serial.print ("\n  -> XYscope.BEGIN, ending: Teensy IntervalTimer Setup");
-		pinMode(CFG_Z_blank_pin, OUTPUT);
-		BlankOutput;
+		//Z (blanking) pin is set up & blanked by dacSetup() (TeensyPioOutput::begin)
 	#endif	
 	
 	// Perform DAC setup
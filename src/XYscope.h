@@ -2,7 +2,7 @@
 #ifndef XYs		//Include-Guard to prevent multiple includes...
 	#define XYs
 	
-	#if (ARDUINO >=100)
+	#if (ARDUINO >=100) || defined(XYSCOPE_HOST)	//HOST: Arduino.h is the shim in extra/host
 		#include "Arduino.h"
 	#else
 		#include "WProgram.h"
@@ -14,6 +14,8 @@
 		//#pragma message "XYscope Lib: Compiling for Arduino DUE"	
 	#elif defined(__MK66FX1M0__)	//This will dump a diag message to screen during compilation - Comment-out next line to suppress message
 		//#pragma message "XYscope Lib: Compiling for TEENSY 3.6"		
+	#elif defined(XYSCOPE_HOST)		//Linux/host build: output goes to the simulation backend (see XYscopeBackend.h)
+		//#pragma message "XYscope Lib: Compiling for HOST simulation"
 	#else							//This will stop compilation and give a 'wrong processor' message as needed
 		#error WRONG PROCESSOR SELECTED - XYscope Library only works with Arduino DUE & Teensy 3.6 Processors
 	#endif
@@ -25,6 +27,8 @@
 
 	extern void ChangeTeensyRefreshInterval(long duration);
 
+	#include "XYscopeBackend.h"	//DAC, blanking & refresh timer output backends
+
 	//void paintCrt2_ISR();						//This is the Refresh CRT ISR declaration
 	//void XY_TimerTestISR();					//TODO this is a test routine...Delete ASAP
 	//void initiateDacDma(void);				//Fires off a DacDMA transfer
@@ -66,10 +70,89 @@
 		void autoSetRefreshTime();						//Automatically sets the best refresh time based on the number points being plotted
 		long getRefreshPeriodUs(void);					//Retrieves the currently active refresh period (us).
 
+		void setLodRefreshUs(uint32_t refresh_us);		//Hold this refresh period and thin the display (LOD) instead of stretching it. 0 = Off
+		uint8_t getLodLevel(void);						//Current LOD level: 0 = every point painted ... LodMaxLevel
+		uint32_t getLodPointsDropped(void);				//Points left out of the last paint by LOD
+		float getPaintCostGain(void);					//Paint time cost model correction (measured / modeled paint time, 1.0 = CFG_Pio...Cycles exact)
+		uint32_t getPaintSliceMaxUs(void);				//Sliced paint (CFG_SlicedPaint): Longest slice measured (us) = worst wait of other interrupts
+		uint32_t getRefreshJitterUs(void);				//Worst difference (us) between a refresh interval and the refresh period
+		void resetPaintJitter(void);					//Restart the getPaintSliceMaxUs() & getRefreshJitterUs() worst case statistics
+
+		//Per-frame telemetry (CFG_TelemetryFrames): records of the last frames painted and percentiles over them
+		struct frameRecord{
+			uint32_t startUs;				//micros() when the paint started
+			uint32_t paintUs;				//Paint time (us)
+			uint32_t points;				//Points painted
+			uint32_t largeSteps;			//Large Steps in the frame
+			uint32_t refreshUs;				//Refresh period in force when the paint started
+			uint32_t jitterUs;				//Difference between the refresh interval that ended at this paint and its period (0 = not known)
+			bool overrun;					//Paint took at least a whole refresh period (refresh stretched or skipped = flicker)
+		};
+		struct frameStats{
+			uint16_t frames;				//Frames the statistics are over
+			uint16_t overruns;				//How many of them are overruns
+			uint32_t paintP50Us, paintP95Us, paintP99Us, paintMaxUs;	//Paint time percentiles (us)
+			uint32_t jitterP50Us, jitterP95Us, jitterP99Us, jitterMaxUs;	//Refresh jitter percentiles (us)
+		};
+		uint16_t getFrameCount(void);					//Frames held by the telemetry ring (0..CFG_TelemetryFrames)
+		bool getFrameRecord(uint16_t age, frameRecord &rec);	//Record of a frame; age 0 = last frame painted.  false if not held
+		void getFrameStats(frameStats &stats, uint16_t window=0);	//Statistics over the last window frames (0 = all held)
+		void resetTelemetry(void);						//Empty the telemetry ring
+
 		//Buffer Management Routines
 		void plotStart();				//Reset current buffer pointer to zero, effectively erasing the existing XY_List array
 		void plotClear();				//Reset current buffer pointer to zero, effectively erasing the existing XY_List array and turning the display OFF
 		void plotEnd();					//Makes sure last points in XYlist are actually actually visualized
+		void plotCommit();				//Hand the completed (back) XY_List to the refresh routine. Swap occurs at start of next paint.
+		bool plotCommitPending();		//Returns true while a committed list is waiting to be picked up by the refresh routine
+
+		//Retained Display-List Segment Routines (Segments are painted after XY_List, in paint order)
+		int segmentCreate(const char *name, int maxPoints);	//Create (or find) a named segment; returns its handle or -1 if out of slots/pool space
+		int segmentFind(const char *name);			//Returns handle of a named segment, or -1 if not found
+		void segmentBegin(int seg);					//Start (re)building a segment.  plotPoint, plotLine, print, etc. now write into the segment
+		void segmentEnd();							//Finish building the segment and resume writing into XY_List
+		void segmentClear(int seg);					//Erase all points of a segment (slot and pool space are kept)
+		void segmentShow(int seg, bool visible=true);	//Show or hide a segment without touching its points
+		void segmentMoveTo(int seg, int position);	//Change paint order of a segment (position 0 = painted first)
+		int segmentPoints(int seg);					//Returns number of points currently held by a segment
+		void segmentPriority(int seg, uint8_t priority);	//LOD priority: 0 (default) = thinned last ... LodLowestPriority = thinned first
+		void segmentDeleteAll();					//Delete all segments and release the whole segment pool
+
+		//Vector Sprites: record a shape once, then stamp copies of it anywhere (no rasterizing per copy)
+		void spriteBegin(int xOrigin, int yOrigin);	//Start recording.  plotPoint, plotLine, print, etc. are recorded relative to (xOrigin, yOrigin)
+		int spriteEnd();							//Stop recording; returns the sprite handle or -1 if out of slots/pool space
+		void spriteStamp(int sprite, int x, int y);	//Plot a sprite with its origin at (x, y); points off screen are dropped as by plotPoint
+		int spritePoints(int sprite);				//Returns number of points in a sprite
+		void spriteDeleteAll();						//Delete all sprites and release the sprite pool
+
+		//2D Transform: Q16 fixed point affine matrix applied to what plotPoint, plotLine, plotCircle, print... draw
+		void resetTransform();						//No transform (identity); the pushTransform() stack is emptied too
+		bool pushTransform();						//Save the current transform; false if CFG_TransformStackDepth are already saved
+		bool popTransform();						//Restore the last saved transform; false if none is saved
+		void translate(int dx, int dy);				//What is drawn next is moved by (dx, dy)...
+		void rotate(float degrees);					//...turned counter-clockwise about (0, 0)...
+		void scale(float s);						//...or scaled about (0, 0)
+		void scale(float sx, float sy);
+		void transformPoint(int &x, int &y);		//Where the current transform puts (x, y)
+
+		//Beam Path Optimizer (CFG_BeamPathOptimizer=true).  Runs in plotEnd(); re-orders strokes to cut down Large Step jumps
+		void setBeamPathOptimizer(bool enable, uint16_t budget_us=CFG_BeamPathBudgetUs);	//Turn the optimizer on/off & set its CPU time budget per list
+		int getBeamPathJumpsSaved();				//Large Step jumps removed from the last list the optimizer worked on
+		long getBeamPathSettleSaved();				//PIO settling time (ns) saved per refresh of the last list the optimizer worked on
+
+		//Primitive Display List Routines (CFG_PrimitiveDisplayList=true).  Figures are stored, not points,
+		//and are rasterized by the PIO refresh routine every paint.  Current graphics/text intensity is captured per primitive.
+		void primClear();											//Erase all primitives
+		void primPoint(int x0, int y0);								//Add a POINT primitive
+		void primLine(int x0, int y0, int x1, int y1);				//Add a LINE primitive
+		void primRectangle(int x0, int y0, int x1, int y1);			//Add four LINE primitives
+		void primCircle(int xc, int yc, int r, uint8_t arcSegment=255);	//Add a CIRCLE (or arc) primitive
+		void primEllipse(int xc, int yc, int xr, int yr, uint8_t arcSegment=255);	//Add an ELLIPSE (or arc) primitive
+		void primChar(char c, int& charX, int& charY, int& charHt);	//Add a Hershey-font GLYPH reference; charX & charY are advanced like plotChar()
+		void primPrint(char const* text);							//Add a string of glyphs at printSetup() location & size
+		int getPrimCount();											//Returns number of primitives in the list
+		uint32_t getPrimBytesUsed();								//Returns RAM (bytes) used by the primitives in the list
+		uint32_t getPrimPointsPainted();							//Returns number of points rasterized from primitives during the last paint
 
 		//Graphics Plotting Routines
 
@@ -117,6 +200,10 @@
 		void printUnderline(int nPlaces);			//Print UNDERLINE character(s)
 		void print(char const * text);				//Print text string (starting at current X-Y location, size, & density, no underline)
 		void print(char const * text,bool UL_flag);	//Print text string (starting at current X-Y location, size, & density, with/without UNDERLINE)
+		int getTextWidth(char const * text);		//Width (pixels) text would take up on one line at the current size, font & spacing; nothing is plotted
+		uint32_t getGlyphCacheHits(void);			//Characters plotted from the glyph cache (CFG_GlyphCacheBytes)
+		uint32_t getGlyphCacheMisses(void);			//Characters that were not in the glyph cache (rasterized from the font ROM)
+		void glyphCacheClear(void);					//Empty the glyph cache and zero its hit & miss counts
 		void print(int number);						//Print integer to screen (starting at current X-Y location, size, & density, no underline)
 		void print(int number,bool UL_Flag);		//Print integer to screen (starting at current X-Y location, size, & density, with/without UNDERLINE)
 		void print(float number);					//Print floating point number to screen (starting at current X-Y location, size, & density), nPlaces to right of DP
@@ -134,13 +221,14 @@
 		//Global Variables used for Performance Metrics Variables
 		long act_PaintTimeDurationMs,act_RefreshIntervalMs,act_PriorRefreshTimeStampMs;
 		long measured_PaintTimeUs, act_PaintTimeDurationUs,act_RefreshIntervalUs,act_PriorRefreshTimeStampUs;	
+		long predicted_PaintTimeUs;				//TEENSY: Paint time of the next frame predicted by the cost model (see autoSetRefreshTime)
 		int act_NumPointsPlotted;
 
 		
 		//Arduino DUE ONLY (DMA related) Variables & Constants
 		static const uint8_t crtBlankingPin=3;		//CRT_Blanking pin (1=CRT_OFF, 0=CRT_ON)
-		uint16_t frontPorchBlankCount=100;			//Calculated and set by setDmaClockRate(int dmaClkFreq); Used to define the duration before CRT unblanks & displays starts at START of DMA transfer
-		uint16_t backPorchBlankCount=100;			//Calculated and set by setDmaClockRate(int dmaClkFreq); Used to define the duration before CRT blanking starts and display ENDS after the completion of a DMA transfer
+		uint16_t frontPorchBlankCount=100;			//Calculated and set by setDmaClockRate(int dmaClkFreq); Used to define the duration before CRT unblanks & displays starts at START of DMA transfer (~60ns counts, sent as blanked DMA points)
+		uint16_t backPorchBlankCount=100;			//Calculated and set by setDmaClockRate(int dmaClkFreq); Used to define the duration before CRT blanking starts and display ENDS after the completion of a DMA transfer (~60ns counts, last point repeated)
 		uint32_t DmaClkFreq_Hz;						//Currently Active DMA Clock FREQUENCY (Hz)
 		float DmaClkPeriod_us;						//Currently Active DMA Clock PERIOD (us)
 
@@ -171,13 +259,17 @@
 													// See void XYscope::initiatePioScreenPaint(void) within XYscope.cpp for valid combinations
 		
 		//CONFIGURATION	- Set initial values for DacSettling and Unblank time, a.k.a. the "Default" settings
-		uint8_t PioLargeSettleCount=CFG_PioLargeSettleCount;		//If more settling time is req'd, add this many steps of delay
-		uint8_t PioSmallSettleCount=CFG_PioSmallSettleCount;		//If more settling time is req'd, add this many steps of delay
-		uint8_t	PioUnblankCount=CFG_PioUnblankCount;				//This sets the width of the dot unblank pulse
+		uint16_t PioLargeSettleNs=CFG_PioLargeSettleNs;			//Large Step DAC settling time (ns); takes effect at the next paint
+		uint16_t PioSmallSettleNs=CFG_PioSmallSettleNs;			//Small Step DAC settling time (ns)
+		uint16_t PioUnblankNs=CFG_PioUnblankNs;					//This sets the width of the dot unblank pulse (ns)
 		uint16_t NoSettlingTimeReqd=CFG_NoSettlingTimeReqd;			//Don't add settling time if points are close to one another
+																	//(Points are tagged with SettleLong_flag as they are plotted; a change
+																	// takes effect on points plotted after the change)
 													
-		//CONFIGURATION	- Use line to set the size of the XYlist buffer.  Note, Actual bytes used = 4 X MaxArraySize
-		static const uint32_t MaxArraySize=CFG_MaxArraySize;	//This sets the max Array size reserved for XY list.  MaxBufferSize must always be <= MaxArraySize!
+		//CONFIGURATION	- Use line to set the size of the XYlist buffer.  Note, Actual bytes used = 4 X MaxArraySize X XYlistBufferCount
+		static const uint8_t XYlistBufferCount = (CFG_DoubleBufferXYlist==true) ? 2 : 1;	//Number of XY_List buffers (2 = front/back double buffering)
+		static const uint32_t MaxArraySize=(CFG_MaxArraySize-CFG_SegmentPoolSize)/XYlistBufferCount;	//This sets the max Array size reserved for EACH XY list.  MaxBufferSize must always be <= MaxArraySize!
+		static const uint32_t SegmentPoolSize=CFG_SegmentPoolSize;	//Points reserved for retained segments (taken out of CFG_MaxArraySize)
 
 		int MaxBuffSize=MaxArraySize-100;			//This sets the size of the XY point plotting buffer (in XY-Point-Pairs). (There is a 100 extra elements defined as an overrun guard)
 													// NOTE: Each XY point pair consumes 4 bytes of RAM. This means that a buffer size of 15000
@@ -210,7 +302,47 @@
 			short X;	//X-coordinate value of a point. Valid range: 0-4095 (See also the "rules" in XYlistEnd comment above!)
 			short Y;	//Y-coordinate value of a point. Valid range: 0-4095 (See also the "rules" in XYlistEnd comment above!)
 		};
-		pointList XY_List[MaxArraySize];	//This reserves & defines the RAM allocated for the XY_List.  Actual value of usable space is set by variable MaxBuffSize
+		pointList XY_ListPool[XYlistBufferCount][MaxArraySize];	//This reserves & defines the RAM allocated for the XY_List(s).  Actual value of usable space is set by variable MaxBuffSize
+		pointList *XY_List;					//Points to the XY_List being BUILT by plotPoint & friends. When CFG_DoubleBufferXYlist=false,
+											//this is also the list being painted.  When true, this is the BACK buffer and
+											//plotCommit() must be called to hand it over to the refresh routine.
+		pointList XY_SegmentPool[SegmentPoolSize+1];	//This reserves the RAM shared by all segments (See segmentCreate)
+
+		//Span (bulk) point append.  Reserve room once, write the points with setPoint(), then plotAppend() them.
+		//There are no per-point screen-saver or end-of-buffer checks.  setPoint() masks X & Y to 12 bits (and adds the
+		//DUE routing flags); it does NOT skip off-screen points the way plotPoint() does when PreventScreenWrap=true.
+		pointList *plotReserve(int &count);		//Returns where the next 'count' points go; count is trimmed to the room left
+		void plotAppend(int count);				//Adds the first 'count' reserved points to the list
+		static inline void setPoint(pointList &p, int x, int y) {	//Store one raw point into a reserved slot
+			#if defined(__SAM3X8E__)
+				p.X = (x & 0xfff) | X_flag;
+				p.Y = (y & 0xfff) | Y_flag;
+			#else
+				p.X = (x & 0xfff);
+				p.Y = (y & 0xfff);
+			#endif
+		}
+
+		//Beam path optimizer stroke tables (See beamPathOptimize)
+		static const uint16_t MaxStrokes = (CFG_BeamPathOptimizer==true) ? CFG_MaxStrokes : 1;
+
+		//Level Of Detail (See setLodRefreshUs).  At LOD level L a run of priority p paints every 2^(L+p-LodLowestPriority)th point (max 8th)
+		static const uint8_t LodLowestPriority = 3;
+		static const uint8_t LodMaxStrideShift = 3;
+		static const uint8_t LodMaxLevel = LodLowestPriority + LodMaxStrideShift;
+
+		//Primitive display list (See primLine, primCircle...)
+		static const uint16_t MaxPrimitives = (CFG_PrimitiveDisplayList==true) ? CFG_MaxPrimitives : 1;
+		struct primitive{
+			uint8_t type;		//_primPointType, _primLineType, _primEllipseType or _primGlyphType
+			uint8_t code;		//Ellipse: arcSegment flags.  Glyph: Hershey ROM index (char-32)
+			uint8_t density;	//Point spacing (_graphDensity or _textDensity when primitive was added)
+			uint8_t spare;
+			short x0, y0;		//Point, Line start, Ellipse center, Glyph cell origin (includes centering offset)
+			short x1, y1;		//Line end, Ellipse radii (xr,yr), Glyph: x1 = scale (Q8)
+			uint32_t step;		//Ellipse: phase accumulator step (2^32 = full circle)
+		};
+		primitive XY_PrimList[MaxPrimitives];
 
 		//Define Justification Flags
 		static const uint8_t LtJustify=0;	//Left Justified Text	(default)
@@ -244,19 +376,16 @@
 		//DUE ONLY constants
 		static const uint16_t X_flag=0x0000;	//These are routing codes used by the DMA hardware to route each integer the right DAC
 		static const uint16_t Y_flag=0x1000;
+		//PIO refresh: Set in X of a point that is more than NoSettlingTimeReqd away from the point before it (Large Step
+		//settling time).  Bit 14 is unused by the 12 bit DACs and by the DUE DMA routing code (bits 12-13).
+		static const uint16_t SettleLong_flag=0x4000;
 
 		// Define & initialize global text X-Y coordinates and text size variables
 		int charX=0,charY=4095, charSize=50;
 		
 
 
-		#if CFG_IncludeVectorFontROM == true
-			#include "VectorFontROM.h"		//Include Font ROM file
-		#endif
-		
-		#if CFG_IncludeHersheyFontROM == true
-			#include "HersheyFontROM.h"
-		#endif
+		//Font ROM tables (VectorFontROM.h, HersheyFontROM.h) are included at file scope in XYscope.cpp
 		
 		//_graphDensity & _textDensity are really private variables; they were made public for diagnostic printout purposes.
 		int _graphDensity;		//value calculated by/set by call to SetGraphicsIntensity(int brightness)	
@@ -268,7 +397,228 @@
 		void dacSetup (void);				//Called within begin(). Initializes and enables dac peripherals.
 		void tcSetup (uint32_t XfrRateHz);	//Called within begin().  Used to initialize Timer Counter TC0 (Drive DAC_DMA channel) at target transfer rate
 		uint32_t FreqToTimerTicks(uint32_t freqHz);	//DUE ONLY - Used within tcSetup to set DMA_Clock Rate
-
+		void paintListSwap(void);			//Called at the START of every paint; picks up the list handed over by plotCommit()
+
+		//Front/Back display list hand-over variables (see plotCommit)
+		pointList * _paintList;				//List currently being painted by the refresh routine (FRONT buffer)
+		int _paintEnd;						//Number of points in _paintList
+		pointList * volatile _pendingList;	//List handed over by plotCommit(), waiting for the next paint to pick it up
+		volatile int _pendingEnd;			//Number of points in _pendingList
+		volatile bool _commitPending;		//true = plotCommit() has handed over a list that has not yet been swapped in
+		uint32_t _buildLargeSteps;			//Points tagged SettleLong_flag in the list (or segment) being built (see settleAnnotate)
+		uint32_t _pendingLargeSteps, _paintLargeSteps;	//...in _pendingList & _paintList
+		uint8_t _backIndex;					//Index (into XY_ListPool) of the buffer currently being built
+
+		//Retained segment variables (see segmentCreate)
+		struct segmentInfo{
+			const char *name;				//Segment name (pointer to caller's string; NOT copied)
+			uint32_t start;					//Index of first point of this segment in XY_SegmentPool
+			int capacity;					//Max number of points this segment can hold
+			volatile int count;				//Number of points currently in the segment
+			volatile bool visible;			//true = painted; false = hidden
+			volatile bool building;			//true = being rebuilt in place; hidden from the paint routines until segmentEnd()
+			uint8_t priority;				//LOD priority (see segmentPriority)
+			uint32_t largeSteps;			//Number of points tagged SettleLong_flag (paint time cost model)
+		};
+		segmentInfo _seg[CFG_MaxSegments];
+		uint8_t _segOrder[CFG_MaxSegments];	//Paint order; holds segment handles
+		uint8_t _segCount;					//Number of segments created
+		uint32_t _segPoolUsed;				//Number of XY_SegmentPool points handed out
+		volatile int _segActive;			//Handle of segment being built (-1 = none, writing into XY_List); read by the paint
+		bool _segInScratch;					//true = active segment is being built in the free tail of XY_List
+		pointList *_segSavedList;			//XY_List, XYlistEnd & MaxBuffSize saved by segmentBegin()
+		int _segSavedEnd, _segSavedMaxBuffSize;
+		uint32_t _segSavedLargeSteps;
+		void segmentWaitPaintIdle(void);	//Wait (interrupts OFF on return) until no DMA or sliced paint is reading any list
+
+		//2D transform variables (see translate, rotate, scale)
+		struct transform{
+			int32_t a, b, c, d;				//X' = a*X + b*Y + tx, Y' = c*X + d*Y + ty; all Q16 (65536 = 1.0)
+			int32_t tx, ty;
+		};
+		static const uint8_t TransformStackSize = CFG_TransformStackDepth > 0 ? CFG_TransformStackDepth : 1;
+		transform _xf;						//Current transform
+		transform _xfStack[TransformStackSize];	//Saved by pushTransform()
+		uint8_t _xfDepth;					//Transforms saved
+		bool _xfOn;							//false = identity: the rasterizers take their untransformed (fast) paths
+		void xfChanged();					//Work out _xfOn after _xf has changed
+		inline void xfPoint(int &x, int &y);	//Apply _xf to a point (only when _xfOn)
+		static int32_t q16(float v);		//float to Q16
+		static int32_t mulQ16(int32_t a, int32_t b);	//Q16 product
+
+		//Vector sprite variables (see spriteBegin)
+		struct spriteInfo{
+			uint16_t start, count;			//Points are XY_SpritePool[start..start+count-1]
+			int16_t xOrigin, yOrigin;		//Sprite origin in the recorded points
+			int16_t xMin, yMin, xMax, yMax;	//Box around the points, relative to the origin
+			uint16_t largeSteps;			//Points after the first tagged SettleLong_flag (see settleAnnotate)
+		};
+		static const bool SpritesOn = CFG_MaxSprites > 0 && CFG_SpritePoolSize > 0;
+		static const uint8_t SpriteSlots = SpritesOn ? CFG_MaxSprites : 1;
+		static const uint16_t SpritePoolSize = SpritesOn ? CFG_SpritePoolSize : 1;
+		spriteInfo _sprite[SpriteSlots];
+		pointList XY_SpritePool[SpritePoolSize];	//Points of all sprites as recorded: 12-bit X & Y, X keeps SettleLong_flag (not painted)
+		uint8_t _spriteCount;				//Number of sprites recorded
+		uint16_t _spritePoolUsed;			//Number of XY_SpritePool points handed out
+		int _spriteRecStart;				//XYlistEnd when spriteBegin() was called (-1 = not recording)
+		int _spriteRecX, _spriteRecY;		//Origin of the sprite being recorded
+		uint32_t _spriteRecLargeSteps;		//_buildLargeSteps when spriteBegin() was called
+
+		//Density-aware line stepper used by plotLine() and the primitive rasterizer.  Jumps straight from one plotted
+		//point to the next (stride = _graphDensity+1 Bresenham steps) using whole + remainder (fixed point) increments.
+		struct lineStepper{
+			int x, y;			//Next point to plot
+			int count;			//Points left to plot
+			int majorStep;		//+/-stride, added to the major axis per plotted point
+			int minorSign;		//+/-1, direction of the minor axis
+			int minorWhole;		//Whole minor axis counts per plotted point
+			int minorFrac;		//Remainder (in 1/minorDen counts) per plotted point
+			int minorDen;		//2 X major axis length
+			int minorRem;		//Running remainder; carries into the minor axis when >= minorDen
+			bool xMajor;		//true = X is the major (longer) axis
+		};
+		void lineStepStart(lineStepper &ls, int x0, int y0, int x1, int y1, int density);
+		inline bool lineStepNext(lineStepper &ls, int &X, int &Y);
+		void lineStepClip(lineStepper &ls);	//Trims a loaded stepper to its on-screen points (PreventScreenWrap)
+
+		//Paint run list: XY_List followed by the visible segments.  Built by paintListSwap() at the start of each paint
+		struct paintRun{
+			pointList *list;
+			int end;
+			uint8_t priority;				//LOD priority (0 for the XY_List)
+		};
+		paintRun _paintRuns[CFG_MaxSegments+1];
+		uint8_t _paintRunCount;
+		uint32_t _paintPointCount;			//Total points in all runs of the current paint
+		uint32_t _paintLargeCount;			//Total Large Steps in all runs of the current paint (first point of each run included)
+		uint32_t _costGainQ16;				//Paint time cost model correction (Q16, 65536 = 1.0)
+		static inline uint32_t nsToCycles(uint16_t ns) {return ((uint32_t) ns * (F_CPU / 1000000) + 999) / 1000;}	//Rounded up
+		uint32_t _smallSettleCycles, _largeSettleCycles, _unblankCycles;	//Pio...Ns in CPU cycles (set by pioPaintStart)
+		void nextFrameCost(uint32_t points[], uint32_t &largeSteps);	//Points (by LOD priority) & Large Steps of the next frame to be painted
+		uint32_t paintCostUs(uint32_t points, uint32_t largeSteps, uint32_t gainQ16);	//Paint time cost model (us)
+		uint32_t _lodRefreshUs;				//LOD target refresh period (us); 0 = LOD off
+		uint8_t _lodLevel;					//Current LOD level
+		uint32_t _lodPointsPainted;			//Points actually painted by the last paint
+		uint32_t _lodPointsDropped;			//Points left out of the last paint
+		inline uint8_t lodShift(uint8_t level, uint8_t priority);	//Decimation (log2 of the point stride) of a priority at a LOD level
+		uint32_t lodSelect(uint32_t points[], uint32_t largeSteps);	//Pick the LOD level for the next paint; returns its predicted paint time (us)
+		volatile uint8_t _dmaRun;			//DUE DMA: Run the next chunk comes from
+		int _dmaPos;						//DUE DMA: Point of that run the next chunk starts at
+		uint8_t _dmaStage;					//DUE DMA: DmaFrontPorch, DmaPainting or DmaDraining
+		static const uint8_t DmaFrontPorch = 0, DmaPainting = 1, DmaDraining = 2;
+		static const uint8_t DmaPorchPadMax = 16;	//DUE DMA: Most back porch points
+		static const int DmaChunkMax = 32767;		//DUE DMA: Most points per chunk (the PDC counts 16 bit half words)
+		pointList _dmaPorchPad[DmaPorchPadMax];		//DUE DMA: Back porch (last point, repeated)
+		uint8_t _dmaPadPoints;				//DUE DMA: Back porch points queued after the last chunk (0 = sent / none)
+		bool dmaNextChunk(const pointList *&chunk, uint16_t &points, int maxPoints);	//Next piece of the frame for the PDC
+		uint16_t dmaPorchPoints(uint16_t porchCount);	//Porch NOP count (~60ns each) to whole DMA points
+		volatile bool _paintActive;			//DUE DMA & TEENSY eDMA: true while a DMA paint is in progress
+
+		inline void screenSaverKick(void);	//Push back the screen saver time-out (called once per figure, not per point)
+		inline int plotRoom(void);			//Number of points that still fit in XY_List (or the segment being built)
+		inline void appendPoint(int x0, int y0);	//plotPoint() without the screen saver update
+		inline bool onScreen(int xMin, int yMin, int xMax, int yMax);	//true if the box needs no per-point screen wrap check
+		void settleAnnotate(int first, int end);	//Set SettleLong_flag on XY_List[first..end-1] (see initiatePioScreenPaint)
+
+		void beamPathOptimize(void);		//Re-order the strokes of XY_List[0..XYlistEnd-1] (see plotEnd)
+		inline long beamPathCost(const pointList &a, const pointList &b);	//Cost of the beam jump from a to b
+		inline pointList &strokeEntry(uint16_t o);	//First point painted of a _strokeOrder entry
+		inline pointList &strokeExit(uint16_t o);	//Last point painted of a _strokeOrder entry
+		uint16_t _strokeStart[MaxStrokes+1];	//Index of the first point of each stroke (+ end of list)
+		uint16_t _strokeOrder[MaxStrokes];	//Stroke paint order; bit 15 set = paint the stroke backwards
+		bool _beamPathOn;					//true = optimizer enabled (setBeamPathOptimizer)
+		uint16_t _beamPathBudgetUs;			//CPU time budget per list (us)
+		int _beamPathJumpsSaved;			//Results of the last optimized list
+		long _beamPathSettleSaved;
+
+		template <class Out> void pioPaint(void);	//PIO refresh loop, compiled for an output backend (see XYscopeBackend.h)
+		template <class Out> void pioPaintStart(void);	//PIO paint: Refresh metrics, list swap & screen saver check
+		template <class Out> bool pioPaintSlice(uint32_t maxPoints);	//PIO paint: Paint up to maxPoints more points; true when the frame is done
+		template <class Out> void pioPaintFinish(void);	//PIO paint: Paint time metrics, cost model & refresh period update
+
+		//Resumable PIO paint state (pioPaintSlice)
+		struct paintState{
+			uint8_t run;					//Run being painted (_paintRunCount = primitive display list)
+			int index;						//Next point of the run (0 = run not started yet)
+			short priorX, priorY;			//Last point written to the DACs
+			bool longSettle;				//Settling time class of the point held by the DACs (not unblanked yet)
+			bool pointWritten;				//true once the DACs hold a point
+			bool primStarted;				//true once the primitive rasterizer has been rewound for this frame
+			int primSkip;					//LOD: Rasterized primitive points still to skip
+			bool screenSaved;				//Screen saver is on: nothing is painted this refresh
+			uint32_t painted;				//Points painted so far
+			long startMs, startUs;			//Paint start time stamps
+			uint32_t startSimUs;			//Host: simulated time at the paint start
+		};
+		paintState _ps;
+		volatile bool _psActive;			//Sliced paint: a frame is being painted
+		uint32_t _slicePoints;				//Sliced paint: points per slice (from CFG_PaintSliceUs & the cost model)
+		uint32_t _sliceMaxUs;				//Longest slice measured
+		uint32_t _refreshJitterUs;			//Worst refresh interval error measured
+		uint32_t _jitterExpectedUs;			//Refresh period in force when the current interval started (0 = not known yet)
+		uint32_t _frameJitterUs;			//Telemetry: jitter measured at the start of the frame being painted
+		static const uint16_t FrameRingSize = CFG_TelemetryFrames > 0 ? CFG_TelemetryFrames : 1;
+		frameRecord _frames[FrameRingSize];	//Telemetry ring
+		uint16_t _frameNext, _frameCount;	//Telemetry: next record to write, records held
+		void frameRecordAdd(uint32_t painted, uint32_t largeSteps);	//Telemetry: record the frame pioPaintFinish() just finished
+		static uint32_t percentileUs(uint32_t *v, uint16_t n, uint8_t pct);	//Sorts v, returns its pct percentile (nearest rank)
+		static XYscope *_sliceOwner;		//Instance painted by paintSliceIsr() & dmaHalfIsr()
+		static void paintSliceIsr(void);	//Sliced paint software interrupt handler
+		void paintSlice(void);				//Paint one slice; finish the frame or ask for the next slice
+
+		//TEENSY eDMA + PDB paint (CFG_TnsyDmaPaint)
+		uint8_t _dmaDrain;					//0 = painting, 1 = last samples written, 2 = idle half written (stop at next interrupt)
+		static void dmaHalfIsr(void);		//DMA interrupt: half of the sample ring has been sent
+		void dmaRefill(uint8_t half);		//Refill the half just sent, or stop & finish the frame
+		void dmaFillHalf(uint8_t half);		//Build the next samples of the frame into one half of the ring
+		template <class Out> inline void pioSettleAndUnblank(bool LongSettle);	//PIO: Wait for DACs to settle, then pulse the beam ON for the point held by the DACs
+
+		//Primitive display list variables & rasterizer (stepper) state
+		static const uint8_t _primPointType = 1, _primLineType = 2, _primEllipseType = 3, _primGlyphType = 4;	//primitive.type codes
+		volatile uint16_t _primCount;		//Number of primitives in XY_PrimList
+		uint32_t _primPointsPainted;		//Points rasterized from primitives during the last paint
+		primitive *primAdd(uint8_t type, uint8_t density);	//Returns next free XY_PrimList slot (or NULL if full)
+		void primRasterStart(void);			//Rewind the rasterizer to the first primitive
+		bool primNextPoint(short &X, short &Y);	//Rasterize the next point; returns false when all primitives are done
+		void primLineStart(int x0, int y0, int x1, int y1, uint8_t density);
+		bool primLineNext(int &X, int &Y);
+		int32_t sinQ15(uint32_t phase);		//sin() of a 32-bit phase (2^32 = full circle); Q15 result
+		uint32_t arcPhaseStep(int xr, int yr);	//Phase step that spaces circle/ellipse points _graphDensity apart
+		void plotArcPoints(int xc, int yc, int xr, int yr, uint8_t arcSegment);	//Integer circle/ellipse rasterizer (plotCircle, plotEllipse)
+		bool hersheyCharLayout(char &c, int charHt, float &charScale, int &xStartOffset, int &charWidth);	//Hershey cell size & centering
+		int charAdvance(char c, int charHt);		//How far plotChar() moves charX for this character (no plotting)
+
+		//Glyph cache (CFG_GlyphCacheBytes): points of rasterized characters, relative to the character cell origin
+		struct glyphPoint {int16_t x, y;};
+		struct glyphEntry {
+			uint32_t lastUse;				//_glyphClock when last plotted (least recently used is dropped first); 0 = free slot
+			int16_t charHt, density, spacing;	//Key: size, _textDensity & _fontSpacing...
+			char c;							//...character...
+			uint8_t font;					//...and font
+			int16_t advance;				//How far the character moves charX
+			int16_t xMin, yMin, xMax, yMax;	//Box around the points
+			uint16_t first, count;			//Points are _glyphPool[first..first+count-1]
+		};
+		static const uint16_t GlyphPoolSize = CFG_GlyphCacheBytes >= 4 ? CFG_GlyphCacheBytes / 4 : 1;
+		static const uint8_t GlyphSlots = CFG_GlyphCacheBytes >= 4 && CFG_GlyphCacheGlyphs > 0 ? CFG_GlyphCacheGlyphs : 1;
+		static const int GlyphOrigin = 1024;		//Cell origin used when a character is rasterized for the cache
+		static const int GlyphMaxHt = 1024;		//Taller characters are not cached (they might not fit on screen at GlyphOrigin)
+		glyphPoint _glyphPool[GlyphPoolSize];	//Cached points, packed in slot order of first
+		glyphEntry _glyphs[GlyphSlots];
+		uint16_t _glyphPoolUsed;			//Points in use at the start of _glyphPool
+		uint32_t _glyphClock, _glyphHits, _glyphMisses;
+		bool glyphCachePlot(char c, int &charX, int &charY, int &charHt);	//Plot c from the cache (adding it first if needed); false = not cacheable
+		glyphEntry *glyphCacheAdd(char c, int charHt);	//Rasterize c at GlyphOrigin and keep its points; NULL if it can't be cached
+		void glyphCacheDrop(glyphEntry &e);	//Free a slot and close up the gap its points leave in _glyphPool
+		uint16_t _rsPrim;					//Index of primitive being rasterized
+		bool _rsActive;						//true = _rsPrim has been started
+		lineStepper _rsLine;				//Line stepper
+		bool _rsLineActive;
+		uint32_t _rsPhase;					//Ellipse stepper
+		bool _rsLast;						//Ellipse stepper: phase has wrapped; current point is the last one
+		int _rsVertex;						//Glyph stepper: byte offset of next vertex within the glyph's HersheyVertexStream[] run
+		int _rsPenX, _rsPenY;				//Glyph stepper: previous vertex (ROM units)
+		bool _rsPenDown;					//Glyph stepper: true = previous vertex is valid (no pen-up since)
 
 		//Private Variables
 
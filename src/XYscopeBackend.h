@@ -0,0 +1,502 @@
+//XYscopeBackend.h
+
+
+/*
+
+Output backends for the XYscope library.
+
+A backend is the only code that touches the X & Y DACs, the Z (blanking) pin, the refresh timer and
+(DUE DMA only) the DAC clock & DMA hardware.  Each backend is a struct of static inline functions.
+The PIO refresh loop (XYscope::pioPaint) is a template that is compiled for one backend, so there is
+no run time cost compared to writing the hardware registers right in the loop.
+
+	TeensyPioOutput		TEENSY 3.6: DAC0/DAC1 register writes from the refresh IntervalTimer ISR
+	DuePioOutput		Arduino DUE: analogWrite() from the Timer3 refresh ISR
+	DueDmaOutput		Arduino DUE: TC0 clocks the DACC, the PDC (DMA) feeds it; dacHandler() keeps the PDC's
+						next buffer (TNPR/TNCR) loaded with the next chunk of the frame
+	HostSimOutput		Linux/host build (XYSCOPE_HOST defined): records every DAC write and blanking edge
+						with a simulated time stamp so the library can be measured & tested off-target
+	DmaSchedule			TEENSY 3.6 & host (CFG_TnsyDmaPaint): a PIO backend that writes DMA samples instead of
+						driving the hardware; pioPaintSlice() compiled for it fills the DMA sample ring
+	TeensyDmaOutput		TEENSY 3.6: PDB paced eDMA sends the sample ring to the Z pin, DAC0 & DAC1
+	HostDmaOutput		Linux/host build: plays the sample ring into HostSimOutput, half by half, calling the
+						refill interrupt in between like the eDMA does
+
+XYscopePioOutput is the PIO backend for the board being compiled, XYscopeDmaOutput the TEENSY/host DMA one.
+
+PIO backend functions (TeensyPioOutput, DuePioOutput, HostSimOutput):
+	begin()					One time DAC & blanking pin setup (called by XYscope::dacSetup)
+	paintBegin()			Called at the start of every PIO paint
+	writeXY(x,y)			Send one point to the DACs (12 bit values, flags already removed)
+	blank(), unblank()		Z axis: beam OFF, beam ON
+	delayCycles(n)			Busy wait n CPU cycles, timed by the cycle counter (settling time and unblank pulse width)
+	setRefreshPeriod(us)	Change the refresh timer period
+
+Sliced paint functions (CFG_SlicedPaint; TeensyPioOutput & HostSimOutput only):
+	timeUs()				Time stamp (us) used to measure paint slices
+	sliceAttach(isr)		One time setup of the low priority interrupt that paints the slices
+	slicePend()				Ask for isr to run (again) as soon as no higher priority interrupt is running
+
+DMA sample ring functions (TeensyDmaOutput, HostDmaOutput):
+	begin(isr)				One time DMA & PDB setup; isr is called each time half of the ring has been sent
+	start(sampleNs)			Start sending the ring from sample 0, one sample every sampleNs
+	sentHalf()				From isr: which half (0 or 1) was just sent and may be refilled
+	stop()					Stop sending & blank the beam
+
+*/
+
+#ifndef XYSCOPEBACKEND_H_	//#include Guard
+	#define XYSCOPEBACKEND_H_
+
+	#if defined CFG_PioPositiveBlankingLogic
+		#define BlankOutput digitalWrite(CFG_Z_blank_pin,LOW)		//TEENSY Macro to blank CRT, LOGIC 1 = BEAM ON
+		#define UnblankOutput digitalWrite(CFG_Z_blank_pin,HIGH)	//TEENSY Macro to unblank CRT, LOGIC 1 = BEAM ON
+	#else
+		#define BlankOutput digitalWrite(CFG_Z_blank_pin,HIGH)		//TEENSY Macro to blank CRT, LOGIC 1 = BEAM OFF
+		#define UnblankOutput digitalWrite(CFG_Z_blank_pin,LOW)		//TEENSY Macro to unblank CRT, LOGIC 1 = BEAM OFF
+	#endif
+
+	#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		//----------------------------------------------------
+		//  DMA SAMPLE SCHEDULE (TEENSY 3.6 & HOST)
+		//----------------------------------------------------
+		//	One sample = toggle the Z pin if z != 0, THEN write xy (X in the low half word) to the DACs, then hold
+		//	until the next sample.  The paint loop's calls are turned into samples: writeXY() only remembers the
+		//	point; the delayCycles() before unblank() become settling samples (beam OFF, first one moves the DACs)
+		//	and the ones before blank() become unblank samples (beam ON).  Every time is rounded UP to whole
+		//	samples (at least one).  Beam ON/OFF toggles alternate, starting from OFF, so the Z pin only needs a
+		//	toggle register.  begin(h) points the builder at half h of the ring; pad() fills the rest of it.
+		struct DmaSchedule {
+			static const uint16_t RingSamples = CFG_TnsyDmaPaint ? 2 * CFG_TnsyDmaHalfSamples : 2;	//No RAM unless enabled
+			static const uint16_t HalfSamples = RingSamples / 2;
+			static uint32_t z[RingSamples];			//Z pin toggle mask (0 = no change)
+			static uint32_t xy[RingSamples];		//X | Y << 16
+			static uint32_t zMask;					//Toggle mask of the Z pin
+			static uint32_t cycle_ps, sample_ps;	//Time of one CPU cycle (delayCycles) & of one sample
+			static uint32_t curXY, pendingZ;		//Point to hold, toggle to do at the next sample
+			static uint16_t next, end;				//Next sample to write, end of the half being filled
+			static uint32_t delayCycles_n;			//delayCycles() cycles since the last unblank()/blank()
+			static bool beamOn;
+
+			static inline void begin(uint8_t half) {next = half * HalfSamples; end = next + HalfSamples;}
+			static inline uint16_t room(void) {return end - next;}
+			static inline uint16_t ticks(uint32_t cycles) {	//Samples needed to cover a delay of that many CPU cycles
+				uint32_t t = (cycles * cycle_ps + sample_ps - 1) / sample_ps;
+				return t > 0 ? t : 1;
+			}
+			static inline void emit(uint16_t n) {
+				for (; n > 0 && next < end; n--) {
+					z[next] = pendingZ;
+					xy[next++] = curXY;
+					pendingZ = 0;
+				}
+			}
+			static inline void pad(void) {emit(room());}	//Hold the last point (beam OFF after the pending toggle)
+			static inline void flush(void) {emit(1);}		//Frame done: do the last (beam OFF) toggle
+
+			//PIO backend interface (see pioPaintSlice)
+			static inline void paintBegin(void) {pendingZ = 0; delayCycles_n = 0; beamOn = false;}
+			static inline void writeXY(int16_t x, int16_t y) {curXY = (uint16_t) x | (uint32_t) y << 16;}
+			static inline void delayCycles(uint32_t n) {delayCycles_n += n;}
+			static inline void unblank(void) {
+				emit(ticks(delayCycles_n));	//Settling time
+				delayCycles_n = 0;
+				pendingZ ^= zMask;
+				beamOn = true;
+			}
+			static inline void blank(void) {
+				if (beamOn) {
+					emit(ticks(delayCycles_n));	//Unblank pulse width
+					pendingZ ^= zMask;
+					beamOn = false;
+				}
+				delayCycles_n = 0;
+			}
+		};
+	#endif
+
+	#if defined(__MK66FX1M0__)
+		//----------------------------------------------------
+		//  TEENSY 3.6 PIO BACKEND
+		//----------------------------------------------------
+		struct TeensyPioOutput {
+			static inline void begin(void) {
+				pinMode(CFG_Z_blank_pin, OUTPUT);
+				BlankOutput;
+				ARM_DEMCR |= ARM_DEMCR_TRCENA;			//Start the CPU cycle counter (delayCycles)
+				ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+				SIM_SCGC2 |= SIM_SCGC2_DAC0; // enable DAC0 clock
+				SIM_SCGC2 |= SIM_SCGC2_DAC1; // enable DAC1 clock
+				//There are three DAC control registers for each DAC (0,1,2).   DACx_C0, DACx_C1, DACx_C2 where x= DAC # (0 or 1)
+
+				//==DAC Control Register_0 Setup
+				#if defined CFG_TNSY_DacRefVolts_LOW
+					DAC0_C0 = DAC_C0_DACEN; 				//Enab DAC_0 using 1.5V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
+					DAC1_C0 = DAC_C0_DACEN; 				//Enab DAC_1 using 1.5V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
+				#else
+					DAC0_C0 = DAC_C0_DACEN | DAC_C0_DACRFS; //Enab DAC_0 using 3.3V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
+					DAC1_C0 = DAC_C0_DACEN | DAC_C0_DACRFS; //Enab DAC_1 using 3.3V Ref_Voltage (Sec 41.5.4 _3.6_Man_Pg 1043)
+				#endif
+			}
+			static inline void paintBegin(void) {}
+			static inline void writeXY(int16_t x, int16_t y) {
+				*(int16_t *)&(DAC0_DAT0L)=x;	//Send X value to DAC0
+				*(int16_t *)&(DAC1_DAT0L)=y;	//Send Y value to DAC1
+			}
+			static inline void blank(void) {BlankOutput;}
+			static inline void unblank(void) {UnblankOutput;}
+			static inline void delayCycles(uint32_t n) {
+				uint32_t start = ARM_DWT_CYCCNT;
+				while (ARM_DWT_CYCCNT - start < n);
+			}
+			static inline void setRefreshPeriod(long us) {ChangeTeensyRefreshInterval(us);}	//IntervalTimer lives in the sketch
+			static inline uint32_t timeUs(void) {return micros();}
+			static inline void sliceAttach(void (*isr)(void)) {
+				attachInterruptVector(IRQ_SOFTWARE, isr);
+				NVIC_SET_PRIORITY(IRQ_SOFTWARE, CFG_PaintIrqPriority);
+				NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+			}
+			static inline void slicePend(void) {NVIC_SET_PENDING(IRQ_SOFTWARE);}
+		};
+		typedef TeensyPioOutput XYscopePioOutput;
+
+		//----------------------------------------------------
+		//  TEENSY 3.6 eDMA + PDB BACKEND
+		//----------------------------------------------------
+		//	zDma is requested by the PDB once per sample: one 32 bit write of DmaSchedule::z[] to the Z pin's GPIO
+		//	toggle register (PTOR); its minor loop then links to xyDma, which writes X to DAC0_DAT0L and, DAC1 being
+		//	0x1000 higher, Y to DAC1_DAT0L (minor loop offset brings the destination back to DAC0).  Both walk the
+		//	whole ring and wrap; zDma interrupts at the half & at the end of the ring.  A linked minor loop leaves
+		//	9 bits of major loop count, which is why the ring is at most 2 x 255 samples.
+		#include <DMAChannel.h>
+		#define XYSCOPE_PIN_REG_(pin, reg) CORE_PIN##pin##reg
+		#define XYSCOPE_PIN_REG(pin, reg) XYSCOPE_PIN_REG_(pin, reg)
+		struct TeensyDmaOutput {
+			static DMAChannel zDma, xyDma;
+
+			static void begin(void (*isr)(void)) {
+				SIM_SCGC6 |= SIM_SCGC6_PDB;	//Enable PDB clock
+				DMA_CR |= DMA_CR_EMLM;		//Minor loop offsets (xyDma)
+				DmaSchedule::zMask = 1 << XYSCOPE_PIN_REG(CFG_Z_blank_pin, _BIT);
+				int16_t dacStep = (uintptr_t) &DAC1_DAT0L - (uintptr_t) &DAC0_DAT0L;
+
+				zDma.TCD->SOFF = 4;
+				zDma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);	//32 bit
+				zDma.TCD->NBYTES_MLNO = 4;
+				zDma.TCD->SLAST = -(int32_t) sizeof(DmaSchedule::z);
+				zDma.TCD->DADDR = &XYSCOPE_PIN_REG(CFG_Z_blank_pin, _PORTREG) + 3;	//PDOR + 3 words = PTOR (toggle)
+				zDma.TCD->DOFF = 0;
+				zDma.TCD->DLASTSGA = 0;
+				zDma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR | DMA_TCD_CSR_MAJORELINK | DMA_TCD_CSR_MAJORLINKCH(xyDma.channel);
+				zDma.triggerAtHardwareEvent(DMAMUX_SOURCE_PDB);
+				zDma.attachInterrupt(isr);
+
+				xyDma.TCD->SOFF = 2;
+				xyDma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);	//16 bit
+				xyDma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_DMLOE | DMA_TCD_NBYTES_MLOFFYES_MLOFF(-2 * dacStep) | DMA_TCD_NBYTES_MLOFFYES_NBYTES(4);
+				xyDma.TCD->SLAST = -(int32_t) sizeof(DmaSchedule::xy);
+				xyDma.TCD->DADDR = &DAC0_DAT0L;
+				xyDma.TCD->DOFF = dacStep;
+				xyDma.TCD->DLASTSGA = 0;
+				xyDma.TCD->CSR = 0;
+			}
+			static void start(uint32_t sampleNs) {
+				BlankOutput;	//Toggles start from beam OFF
+				zDma.TCD->SADDR = DmaSchedule::z;
+				zDma.TCD->CITER_ELINKYES = DMA_TCD_CITER_ELINKYES_ELINK | DMA_TCD_CITER_ELINKYES_LINKCH(xyDma.channel) | DMA_TCD_CITER_ELINKYES_CITER(DmaSchedule::RingSamples);
+				zDma.TCD->BITER_ELINKYES = zDma.TCD->CITER_ELINKYES;
+				xyDma.TCD->SADDR = DmaSchedule::xy;
+				xyDma.TCD->CITER_ELINKNO = DmaSchedule::RingSamples;
+				xyDma.TCD->BITER_ELINKNO = DmaSchedule::RingSamples;
+				zDma.enable();
+				PDB0_IDLY = 0;
+				PDB0_MOD = max((uint32_t) ((uint64_t) F_BUS * sampleNs / 1000000000ULL), (uint32_t) 2) - 1;
+				PDB0_SC = PDB_SC_TRGSEL(15) | PDB_SC_PDBEN | PDB_SC_CONT | PDB_SC_PDBIE | PDB_SC_DMAEN | PDB_SC_LDOK;
+				PDB0_SC = PDB_SC_TRGSEL(15) | PDB_SC_PDBEN | PDB_SC_CONT | PDB_SC_PDBIE | PDB_SC_DMAEN | PDB_SC_SWTRIG;	//Go
+			}
+			static inline uint8_t sentHalf(void) {	//CITER counts down & reloads at the end of the ring
+				zDma.clearInterrupt();
+				return (zDma.TCD->CITER_ELINKYES & 0x1ff) > DmaSchedule::HalfSamples ? 1 : 0;
+			}
+			static void stop(void) {
+				PDB0_SC = 0;
+				zDma.disable();
+				BlankOutput;
+			}
+		};
+		typedef TeensyDmaOutput XYscopeDmaOutput;
+	#endif
+
+	#if defined(__SAM3X8E__)
+		//----------------------------------------------------
+		//  DUE PIO & DMA BACKENDS
+		//----------------------------------------------------
+		//This timer is only used when working with Arduino DUE
+		#include <DueTimer.h>	//Timer library for DUE; download this library from the Arduino.org site
+								//Timer library is also available from author at https://github.com/ivanseidel/DueTimer
+
+		struct DueDmaOutput {
+			static inline void begin(void) {
+				pmc_enable_periph_clk (DACC_INTERFACE_ID); 	// start clocking DAC
+
+				dacc_reset (DACC);		//This returns DAC hardware to power-up conditions
+
+				dacc_set_transfer_mode(DACC, 0);//for this variable, 0=HALFWORD_MODE (16 bits integers) or 1=FULLWORD_MODE (32 bit integers)
+				dacc_set_power_save(DACC, 0, 0);	//Setup of DAC Power_Save option
+				// Set DACC Analog Current Register - Use typical recommended values of 0x01 for IBCTLDACCORE and 0x02 for IBCTLCH0/IBCTLCH1
+				// This may sets the slew rate of DACC register & IBCTLDACCH0/IBCTLDACCH1:
+				dacc_set_analog_control(DACC,
+						DACC_ACR_IBCTLCH0(0x02) | DACC_ACR_IBCTLCH1(0x02)
+								| DACC_ACR_IBCTLDACCORE(0x01));
+				dacc_set_trigger(DACC, 1);
+
+				dacc_enable_channel(DACC, 0);	//Enable DAC0
+				dacc_enable_channel(DACC, 1);	//Enable DAC1
+
+				// DACC_MR bit definitions
+				//
+				//	|	31	|	30	|	29	|	28	|	27	|	26	|	25	|	24	|
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	STARTUP TIME: Time till initial startup conversion
+				//	|		|		|<-------------- STARTUP TIME ----------------->|	0=0 periods of DACC CLOCK, 63=4032 periods of DACC CLOCK
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	Typical value = 3 to 8. (See table on pg 1366 of HW Data Sheet for more details)
+				//
+				//	|	23	|	22	|	21	|	20	|	19	|	18	|	17	|	16	|
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	MAXS: Startup after wake up; 0=Normal (No Sleep), 1=Fast Wake up Sleep Mode
+				//	|		|		| MAXS	|  TAG	|		|		|<--USER  SEL-->|	TAG: 0=DIS (Tag Selection Mode Disabled, using USER_SEL value to chan conversion
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	USER_SEL: 0=Chan 0 Selected, 1=Chan 1 Selected (Only meaningful when TAG=1)
+				//
+				//	|	15	|	14	|	13	|	12	|	11	|	10	|	 9	|	 8	|
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	DAC AUTO REFRESH PERIOD
+				//	|<----------------------   REFRESH   -------------------------->| 	0: No DAC Refresh, >0: DAC Refresh Period = 1024 * REFRESH_VALUE/DACC_CLOCK
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+
+				//
+				//	|	7	|	6	|	5	|	4	|	3	|	2	|	 1	|	 0	|
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	FAST WKUP: 0=Sleep Mode defined by SLEEP bit, 1=Fast Wak up Sleep Mode (Vref ON Between Conversions but DAC core is OFF)
+				//	|		|FSTWKUP| SLEEP	|WRD MOD|<----- TRIG SEL ------>| TRGEN	|	SLEEP: 0=Normal (No Sleep), 1=Sleep Mode (Sleeps between conversions)
+				//	+-------+-------+-------+-------+-------+-------+-------+-------+	WORD/HALF-WORD MODE: 0=Half Word Mode (16 Bit), 1=Full Word Mode (32 Bit)
+				//																		TRIG SEL: 0=Ext, 1=TC0_CH0, 2=TC0_CH1, 3=TC0_CH2,4=PWM Event_0,5=PWM Event_1,6=RESRVD,7=RESERVD
+				//																		TRGEN (Trig Enable): 0=Disabled, DACC in Free Run Mode, 1=Ext Trig mode.
+				//	DACC_MR REGISTER SETTINGS...
+				//		STARTUP TIME
+				DACC->DACC_MR |= 8 << 24;		//8=512 DACC clock periods of startup time.
+				//		MAXS Mode bit
+				DACC->DACC_MR |= 0 << 16;		//No Bits Set, MAXS=0 meaning NO SLEEP
+				//		TAG MODE Bit
+				DACC->DACC_MR |= 1 << 20;//TAG=1 (Bits 12,13 of incomming data selects DAC0/DAC1 destination )
+				//		DAC REFRESH
+				DACC->DACC_MR |= 0 << 8;//No Bits Set.  REFRESH=0, meaning NO AUTO REFRESH DESIRED
+				//		FSTWKUP, SLEEP,WRD MODE, TRIG SEL, TRig ENABLE
+				DACC->DACC_MR |= 0;	//No Bits Set.  HALF_WORD MODE, EXT-TRIG, TRIG DISABLED
+
+				//----------------------------------------------------
+				//  DUE Interrupt Controller SETUP
+				//----------------------------------------------------
+				NVIC_DisableIRQ (DACC_IRQn);//Disable DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
+				NVIC_ClearPendingIRQ(DACC_IRQn);//Clear any pending DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
+				NVIC_EnableIRQ(DACC_IRQn);//Now, ENABLE DACC IRQ in the Nested Vectored Interrupt Controller (NVIC)
+			}
+			static inline void setClock(uint32_t tcTicks) {	//Start TC0 (the DAC transfer clock); period in TC0 clock ticks
+				// Send TC0 Clock signal to external pin so AGS hardware can se it to sync things up
+				int ulPin = 2; // just an example:   it's 2  for the Timer0 TIOAO
+				PIO_Configure(g_APinDescription[ulPin].pPort,
+						g_APinDescription[ulPin].ulPinType,
+						g_APinDescription[ulPin].ulPin,
+						g_APinDescription[ulPin].ulPinConfiguration);
+
+				// Enable TC0
+				pmc_enable_periph_clk (TC_INTERFACE_ID);
+
+				//Set Mode and Frequency of TC0
+				Tc * tc = TC0;
+				TcChannel * t = &tc->TC_CHANNEL[0];
+				t->TC_CCR = TC_CCR_CLKDIS;
+				t->TC_IDR = 0xFFFFFFFF;
+				t->TC_SR;
+				t->TC_RC = tcTicks;    		// Sets PERIOD of timer in "tcTicks" units
+				t->TC_RA = (tcTicks - tcTicks / 2);	// Use this value to alter clock signal symmetry...(tcTicks/2 = 50%)
+
+				//TC_CMR = Timer Counter Channel Mode Register, a four byte register used to set WAVEFORM MODE
+				//	Note: Since the DUE MCK = 84 MHz, the following master clock source settings are available
+				// 		TC-CMR_TCCLOCKS_TIMER_CLOCK1 sets the clock source to be =  MCK/2  (48.0   MHz)
+				// 		TC-CMR_TCCLOCKS_TIMER_CLOCK2 sets the clock source to be =  MCK/8  (10.5   MHz)
+				// 		TC-CMR_TCCLOCKS_TIMER_CLOCK3 sets the clock source to be =  MCK/32 ( 2.652 MHz)
+				// 		TC-CMR_TCCLOCKS_TIMER_CLOCK3 sets the clock source to be =  MCK/128( 0.65625 MHz or 656.25 KHz)
+				t->TC_CMR = TC_CMR_TCCLKS_TIMER_CLOCK1 | TC_CMR_WAVE
+						| TC_CMR_WAVSEL_UP_RC;
+				t->TC_CMR = (t->TC_CMR & 0xFFF0FFFF) | TC_CMR_ACPA_CLEAR
+						| TC_CMR_ACPC_SET;
+				t->TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+			}
+			static inline void startRun(const void *list, uint32_t halfWords) {	//Load the first chunk of a frame (see go)
+				DACC->DACC_PTCR = DACC_PTCR_TXTDIS;	//Hold the PDC while both buffers are loaded
+				DACC->DACC_TPR = (uint32_t) list;	//(DACC_TPR) = Transmit (source data) Pointer Register
+				DACC->DACC_TCR = halfWords;			//(DACC_TCR)= Transmit Count Register (TCR=How many Short-Integers to transfer).
+				DACC->DACC_TNCR = 0;				//(DACC_TNCR)= Transmit NEXT Counter Register: nothing queued yet
+			}
+			static inline void queueNext(const void *list, uint32_t halfWords) {	//Chunk the PDC moves on to when TCR reaches 0
+				DACC->DACC_TNPR = (uint32_t) list;	//(DACC_TNPR) = Transmit NEXT Pointer Register
+				DACC->DACC_TNCR = halfWords;		//Loading TNCR clears ENDTX
+			}
+			static inline void go(void) {DACC->DACC_PTCR = DACC_PTCR_TXTEN;}	//(DACC_PTCR) = Transfer Enable Register. This is how we START a transfer!
+			static inline bool endOfTransfer(void) {	//true if this DACC interrupt is a true ENDTX (End of Transmit Buffer) event
+				return (dacc_get_interrupt_status(DACC) & DACC_ISR_ENDTX) == DACC_ISR_ENDTX;
+			}
+			static inline bool allSent(void) {	//TXBUFE: current AND next buffer are both empty
+				return (dacc_get_interrupt_status(DACC) & DACC_ISR_TXBUFE) == DACC_ISR_TXBUFE;
+			}
+			static inline void enableEndInterrupt(void) {dacc_enable_interrupt(DACC, DACC_IER_ENDTX);}
+			static inline void disableEndInterrupt(void) {dacc_disable_interrupt(DACC, DACC_IER_ENDTX);}
+			static inline void enableEmptyInterrupt(void) {dacc_enable_interrupt(DACC, DACC_IER_TXBUFE);}
+			static inline void disableEmptyInterrupt(void) {dacc_disable_interrupt(DACC, DACC_IER_TXBUFE);}
+			static inline void blank(void) {digitalWrite(CFG_Z_blank_pin, HIGH);}	//DMA hardware: HIGH = BLANKED
+			static inline void unblank(void) {digitalWrite(CFG_Z_blank_pin, LOW);}
+			static inline void setRefreshPeriod(long us) {Timer3.start(us);}
+		};
+
+		struct DuePioOutput {
+			static inline void begin(void) {	//Same DACC setup as DMA
+				DueDmaOutput::begin();
+				CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;	//Start the CPU cycle counter (delayCycles)
+				DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+			}
+			static inline void paintBegin(void) {analogWriteResolution(12);}	//Define 12 Bit DAC operating modes
+			static inline void writeXY(int16_t x, int16_t y) {
+				analogWrite(CFG_Due_DAC0_pin,x);	//Send X value to DAC0
+				analogWrite(CFG_Due_DAC1_pin,y);	//Send Y value to DAC1
+			}
+			static inline void blank(void) {BlankOutput;}
+			static inline void unblank(void) {UnblankOutput;}
+			static inline void delayCycles(uint32_t n) {
+				uint32_t start = DWT->CYCCNT;
+				while (DWT->CYCCNT - start < n);
+			}
+			static inline void setRefreshPeriod(long us) {Timer3.start(us);}
+		};
+		typedef DuePioOutput XYscopePioOutput;
+	#endif
+
+	#if defined(XYSCOPE_HOST)
+		//----------------------------------------------------
+		//  HOST SIMULATION BACKEND
+		//----------------------------------------------------
+		//	Nothing is driven; instead the simulated beam is tracked and every output event is counted and
+		//	(optionally) passed to a trace function together with a simulated time stamp.  Time advances by
+		//	a fixed cost per DAC write and per blanking pin write, and by the delay cycles asked for; these default to TEENSY 3.6 like
+		//	values at F_CPU and may be changed before painting.  Statistics are cleared by reset().
+		struct XYscopeSimEvent {
+			uint64_t t_ps;				//Simulated time of the event (pico seconds since reset())
+			uint8_t type;				//SimDac, SimUnblank or SimBlank
+			uint16_t x, y;				//DAC values after the event
+		};
+		struct HostSimOutput {
+			static const uint8_t SimDac = 0, SimUnblank = 1, SimBlank = 2;	//XYscopeSimEvent.type codes
+			static uint64_t now_ps;					//Simulated time (pico seconds)
+			static uint32_t cycle_ps, dacWrite_ps, pinWrite_ps;	//CPU cycle time & simulated cost of each output operation
+			static uint32_t dacWrites, unblanks, paints;	//Event counters
+			static uint64_t beamOn_ps;				//Total time the beam was ON
+			static uint16_t dacX, dacY;				//Current DAC values
+			static bool beamOn;
+			static long refreshPeriod_us;			//Last value passed to setRefreshPeriod()
+			static void (*trace)(const XYscopeSimEvent &e);	//Called for every event when not NULL
+			static void (*sliceIsr)(void);			//Sliced paint "interrupt" (see slicePend)
+			static bool sliceRunning, slicePending;
+
+			static void reset(void) {
+				now_ps = 0; beamOn_ps = 0; dacWrites = 0; unblanks = 0; paints = 0;
+			}
+			static inline void event(uint8_t type) {
+				if (trace) {
+					XYscopeSimEvent e = {now_ps, type, dacX, dacY};
+					trace(e);
+				}
+			}
+			static inline void begin(void) {beamOn = true; blank();}
+			static inline void paintBegin(void) {paints++;}
+			static inline void writeXY(int16_t x, int16_t y) {
+				now_ps += dacWrite_ps;
+				if (beamOn) beamOn_ps += dacWrite_ps;
+				dacX = x; dacY = y;
+				dacWrites++;
+				event(SimDac);
+			}
+			static inline void blank(void) {
+				now_ps += pinWrite_ps;
+				if (beamOn) beamOn_ps += pinWrite_ps;
+				beamOn = false;
+				event(SimBlank);
+			}
+			static inline void unblank(void) {
+				now_ps += pinWrite_ps;
+				beamOn = true;
+				unblanks++;
+				event(SimUnblank);
+			}
+			static inline void delayCycles(uint32_t n) {
+				now_ps += uint64_t(n) * cycle_ps;
+				if (beamOn) beamOn_ps += uint64_t(n) * cycle_ps;
+			}
+			static inline void setRefreshPeriod(long us) {refreshPeriod_us = us;}
+			static inline uint32_t timeUs(void) {return (uint32_t) (now_ps / 1000000);}	//Simulated time
+			static inline void sliceAttach(void (*isr)(void)) {sliceIsr = isr;}
+			static inline void slicePend(void) {	//No interrupts here: run the slices back to back, like a tail chained IRQ
+				slicePending = true;
+				if (sliceRunning || !sliceIsr) return;
+				sliceRunning = true;
+				while (slicePending) {
+					slicePending = false;
+					sliceIsr();
+				}
+				sliceRunning = false;
+			}
+		};
+		typedef HostSimOutput XYscopePioOutput;
+
+		//	Model of the TEENSY eDMA + PDB transfer: start() sends the ring one half at a time into HostSimOutput
+		//	(one DAC write per changed point, one blanking edge per toggle, sample_ps per sample) and calls the
+		//	refill interrupt after each half, until the interrupt calls stop().
+		struct HostDmaOutput {
+			static void (*isr)(void);
+			static bool running;
+			static uint8_t lastHalf;
+			static uint32_t halvesSent;
+
+			static void begin(void (*halfIsr)(void)) {
+				isr = halfIsr;
+				DmaSchedule::zMask = 1;
+			}
+			static void send(uint8_t half) {
+				for (uint16_t i = half * DmaSchedule::HalfSamples; i < (half + 1) * DmaSchedule::HalfSamples; i++) {
+					if (DmaSchedule::z[i]) {
+						HostSimOutput::beamOn = !HostSimOutput::beamOn;
+						if (HostSimOutput::beamOn) HostSimOutput::unblanks++;
+						HostSimOutput::event(HostSimOutput::beamOn ? HostSimOutput::SimUnblank : HostSimOutput::SimBlank);
+					}
+					uint16_t x = DmaSchedule::xy[i] & 0xffff, y = DmaSchedule::xy[i] >> 16;
+					if (x != HostSimOutput::dacX || y != HostSimOutput::dacY) {
+						HostSimOutput::dacX = x;
+						HostSimOutput::dacY = y;
+						HostSimOutput::dacWrites++;
+						HostSimOutput::event(HostSimOutput::SimDac);
+					}
+					HostSimOutput::now_ps += DmaSchedule::sample_ps;
+					if (HostSimOutput::beamOn) HostSimOutput::beamOn_ps += DmaSchedule::sample_ps;
+				}
+				halvesSent++;
+			}
+			static void start(uint32_t sampleNs) {	//No hardware: send the whole frame right here
+				DmaSchedule::sample_ps = sampleNs * 1000UL;
+				HostSimOutput::blank();
+				running = true;
+				for (uint8_t half = 0; running && isr; half ^= 1) {
+					send(half);
+					lastHalf = half;
+					isr();
+				}
+			}
+			static inline uint8_t sentHalf(void) {return lastHalf;}
+			static inline void stop(void) {running = false;}	//Beam left as the samples set it (should be OFF)
+		};
+		typedef HostDmaOutput XYscopeDmaOutput;
+	#endif
+
+#endif	//End XYSCOPEBACKEND_H_
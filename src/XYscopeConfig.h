@@ -1,5 +1,8 @@
 #ifndef XYsConfig
 	#define XYsConfig
+
+	//	Settings inside '#ifndef' below can also be given on the compiler command line (e.g. -DCFG_SlicedPaint=true);
+	//	the host CMake build (CMakeLists.txt) turns features on that way for its test targets.
 	
 	//	v=========== Maximum Point Array Size =================================v	
 	//	CFG_MaxArraySize sets the size of the XYlist[ ] array. The actual
@@ -21,15 +24,86 @@
 	#if defined(__SAM3X8E__)
 		#define CFG_MaxArraySize 15000		//DUE Array Size Setting
 	#endif
-	#if defined(__MK66FX1M0__)
-		#define CFG_MaxArraySize 35000  	//TEENSY 3.6 Array Size Setting
+	#if defined(__MK66FX1M0__) || defined(XYSCOPE_HOST)
+		#define CFG_MaxArraySize 35000  	//TEENSY 3.6 (and host simulation) Array Size Setting
 	#endif
 	//	^=========== Maximum Point Array Size =================================^
-	
+
+	//=========== Double-Buffered XY_List (Front/Back Display Lists) ========
+	//	When set true, the XY_List RAM is split into two equal halves.  The application builds the
+	//	next frame into the BACK buffer (plotStart, plotPoint, plotLine...) while the refresh interrupt
+	//	keeps painting the FRONT buffer.  Calling plotCommit() hands the finished back buffer to the
+	//	refresh routine; the front/back exchange is a pointer swap done at the start of the next paint
+	//	so a partially built frame is never painted (no tearing).
+	//	NOTE: Total RAM is unchanged; each buffer holds CFG_MaxArraySize/2 points.
+	//	When set false (default), a single XY_List is used and is painted while it is being written.
+	#ifndef CFG_DoubleBufferXYlist
+		#define CFG_DoubleBufferXYlist false	//Set to 'true' to enable front/back display list buffers
+	#endif
+
+	//=========== Retained Display-List Segments ============================
+	//	Segments are independently rebuilt pieces of the display (clock hands, a moving ball, a
+	//	cursor...) that are painted after the main XY_List.  Static content stays in the main list
+	//	while any segment is cleared, rebuilt, shown/hidden or re-ordered without touching the points
+	//	of anything else.  (See segmentCreate(), segmentBegin(), segmentEnd() in XYscope.h)
+	//	CFG_SegmentPoolSize points are taken OUT of CFG_MaxArraySize, so total RAM is unchanged.
+	//	Off by default (0), so every point stays in the main XY_List and segmentCreate() returns -1.
+	//	To use segments, reserve e.g. 1000 points on a DUE or 3000 on a TEENSY 3.6.
+	#define CFG_MaxSegments 8					//Maximum number of named segments (must be >= 1)
+	#ifndef CFG_SegmentPoolSize
+		#define CFG_SegmentPoolSize 0				//Points reserved for segments (0 = no segments)
+	#endif
+
+	//=========== Vector Sprites ============================================
+	//	A sprite is a shape (whatever plotLine, plotCircle, print... draw between spriteBegin() & spriteEnd())
+	//	kept as points relative to its origin.  spriteStamp() adds it to the list at any (x, y) by adding the
+	//	offset to each point; nothing is rasterized again.  Each sprite point takes 4 bytes of RAM.
+	//	Off by default (no RAM taken).  To use sprites set e.g. 8 sprites & 1000 points (~4 KB); the PONG demo
+	//	of CRT_SCOPE_CLOCK stamps its ball as a sprite when they are on.
+	#ifndef CFG_MaxSprites
+		#define CFG_MaxSprites 0					//Maximum number of sprites (0 = no sprites)
+	#endif
+	#ifndef CFG_SpritePoolSize
+		#define CFG_SpritePoolSize 0				//Points shared by all sprites (0 = no sprites)
+	#endif
+
+	//=========== 2D Transform ==============================================
+	//	translate(), rotate() & scale() set a Q16 fixed point affine matrix that plotPoint, plotLine, plotCircle,
+	//	plotEllipse, print (and so on) apply to what they draw: rotated text, spinning sprites, clock hands
+	//	drawn upright and turned...  pushTransform() saves the matrix, popTransform() brings it back.
+	//	Span appends (plotReserve/setPoint/plotAppend) and the primitive display list are NOT transformed.
+	#define CFG_TransformStackDepth 4			//Number of pushTransform() calls that can be nested
+
+	//=========== Primitive Display List ====================================
+	//	When set true, primLine(), primCircle(), primEllipse(), primChar()... store the FIGURE (end points,
+	//	center & radius, arc mask, glyph reference) instead of thousands of points.  The PIO refresh
+	//	routines rasterize these primitives every paint using integer steppers, after the XY_List and
+	//	segments have been painted.  Each primitive takes 16 bytes of RAM, so a full-screen scene fits in
+	//	a few hundred bytes; CFG_MaxArraySize can then be reduced to free RAM for other uses.
+	//	NOTE: Primitives are painted by the PIO refresh routines only (TEENSY 3.6 and DUE PIO, not DUE DMA).
+	#ifndef CFG_PrimitiveDisplayList
+		#define CFG_PrimitiveDisplayList false	//Set to 'true' to enable the primitive display list
+	#endif
+	#define CFG_MaxPrimitives 256			//Max number of primitives (Each Hershey character = 1 primitive)
+
+	//=========== Beam Path Optimizer =======================================
+	//	When set true, plotEnd() (and so plotCommit() & segmentEnd()) re-orders the figures of the list so the
+	//	beam makes fewer Large Step jumps (jumps that need CFG_PioLargeSettleNs settling time) between them.
+	//	A "stroke" is a run of points with no Large Step inside it (a line, a circle, a character...); strokes
+	//	are re-ordered and may be painted backwards, but the points inside a stroke are never split up, so the
+	//	picture is unchanged.  Uses 4 bytes of RAM per stroke; the free tail of the XY_List is used as scratch.
+	//	The optimizer gives up on a list when it has used CFG_BeamPathBudgetUs of CPU time.
+	#ifndef CFG_BeamPathOptimizer
+		#define CFG_BeamPathOptimizer false		//Set to 'true' to enable the beam path optimizer
+	#endif
+	#define CFG_MaxStrokes 512				//Max number of strokes re-ordered per list (the rest stay at the end, in order)
+	#define CFG_BeamPathBudgetUs 2000		//CPU time (us) the optimizer may spend on one list
+
 	//=========== PreventScreenWrap - Screen Fold-Over Management ==========	
 	//	Valid XY coordinates have values that are >= 0 AND <= 4095. The constant
 	//	'PreventScreenWrap' defines how out-of-range XY coordinates are handled.
-	//		If set true, out-of-range points are skipped (aka: not plotted).
+	//		If set true, out-of-range points are skipped (aka: not plotted).  Lines, circles & ellipses
+	//		that run off screen are clipped first, so their off-screen points cost no plotting time.
 	//		If set false, coordinates are masked to 12 bits and then plotted; this means out-of-range
 	//		points will be plotted, but will appear to 'fold-over' to the opposite screen edge.
 	const bool PreventScreenWrap = true;	//Set false to allow out-of-range points to 'fold over' & plot to CRT
@@ -39,6 +113,61 @@
 	#define CFG_CrtMinRefresh_us 20000	//Defines the minimum refresh period (in microseconds)
 										//Common settings: 20,000us (50 Hz refresh rate), 16,666us (60Hz Refresh Rate)
 	
+	//=========== Sliced (Preemptible) PIO Paint ===========================
+	//	Normally the whole frame is painted inside the refresh timer interrupt, so other interrupts (serial, USB,
+	//	push buttons, other timers) wait up to a whole paint time; many ms for a big XY_List.  When set true, the
+	//	refresh interrupt only starts the frame and the points are painted from a low priority software interrupt
+	//	(IRQ_SOFTWARE) in slices of about CFG_PaintSliceUs.  Interrupts with a higher priority than
+	//	CFG_PaintIrqPriority then run right away (they only wait out one unblank pulse); the others wait at most
+	//	one slice.  getPaintSliceMaxUs() & getRefreshJitterUs() report the worst cases measured.
+	//	NOTE: TEENSY 3.6 (and host simulation) only.  loop() still runs only between frames, as before.
+	#ifndef CFG_SlicedPaint
+		#define CFG_SlicedPaint false		//Set to 'true' to paint from the software interrupt, in slices
+	#endif
+	#define CFG_PaintSliceUs 200		//Target length of one slice (us); the worst case wait for equal/lower priority interrupts
+	#define CFG_PaintIrqPriority 224	//TEENSY NVIC priority of the paint interrupt (0 = highest ... 255 = lowest; IntervalTimer uses 128)
+
+	//=========== TEENSY eDMA + PDB Paint ==================================
+	//	When set true, TEENSY 3.6 paints with the DMA controller instead of the CPU: the PDB timer requests one
+	//	DMA "sample" every CFG_TnsyDmaSampleNs; each sample toggles the Z pin (or not) and then writes X & Y to
+	//	DAC0 & DAC1.  The samples are built by the normal paint loop (so LOD, segments & primitives all work)
+	//	into a small two-half ring: while one half is being sent, the DMA interrupt fills the other half.
+	//	Settling & unblank times are the CFG_Pio...Ns delays below, rounded UP to whole samples, so the DMA
+	//	can be slower than PIO for small sample rates; the CPU only spends the time to build the samples.
+	//	NOTE: TEENSY 3.6 (and host simulation) only.  CFG_Z_blank_pin must be a plain pin number.  Takes the place
+	//	of CFG_SlicedPaint.  loop() keeps running while the frame is painted, so use CFG_DoubleBufferXYlist.
+	#ifndef CFG_TnsyDmaPaint
+		#define CFG_TnsyDmaPaint false		//Set to 'true' to paint with eDMA + PDB
+	#endif
+	#define CFG_TnsyDmaSampleNs 200		//Time of one DMA sample (ns); check on a scope that the eDMA keeps up if made shorter
+	#define CFG_TnsyDmaHalfSamples 240	//Samples in each half of the ring (8 bytes each; max 255; must hold 2 points' delays)
+
+	//=========== PIO Paint Time Cost Model ================================
+	//	TEENSY 3.6 autoSetRefreshTime() predicts the paint time of a frame from its number of points and Large Steps
+	//	(points tagged SettleLong_flag) and sets the refresh period before the frame is painted (plotEnd, plotCommit,
+	//	segmentEnd).  These are the starting per-point costs; the prediction is scaled by a gain that is corrected
+	//	after every paint from the measured paint time, so they only need to be roughly right (getPaintCostGain()
+	//	shows the gain; with 8 the host simulation, which costs a point its DAC write and two blanking pin writes,
+	//	settles at 1.00).
+	#define CFG_PioPointCycles 8		//CPU cycles per point, not counting settle & unblank delays (loop, DAC & blanking writes)
+
+	//=========== Fixed Refresh Rate with Level Of Detail (LOD) ============
+	//	Normally a frame that takes too long to paint stretches the refresh period (see autoSetRefreshTime) and
+	//	the display starts to flicker.  When CFG_LodRefresh_us is not 0, the refresh period is held at that value
+	//	and the PIO refresh routine paints only every 2nd, 4th or 8th point of the least important runs instead
+	//	(segmentPriority(): 0 = XY_List, primitives & segments by default ... 3 = thinned first), stepping the LOD
+	//	level up until the predicted paint time fits.  Can also be changed at run time with setLodRefreshUs().
+	//	NOTE: TEENSY 3.6 (and host simulation) PIO refresh only.
+	#define CFG_LodRefresh_us 0			//0 = Off (stretch the refresh period); Example: 20000 = hold a 50 Hz refresh rate
+
+	//=========== Per-frame Telemetry ======================================
+	//	Every paint leaves a record (start time, paint time, points, Large Steps, refresh period, refresh jitter and
+	//	an overrun flag) in a ring holding the last CFG_TelemetryFrames frames.  getFrameStats() gives the p50, p95,
+	//	p99 & max paint time and refresh jitter over them, which shows up intermittent flicker that the last frame
+	//	metrics (act_PaintTimeDurationUs, ...) miss.  Each frame takes 28 bytes of RAM.
+	//	NOTE: PIO (TEENSY & DUE) and TEENSY eDMA paints; not DUE DMA.
+	#define CFG_TelemetryFrames 64		//Frames kept (max 255); 0 = Off
+
 	//=========== FONT SELECTION ===========================================
 	//	Two different FONT files and FONT generation methods are available.
 	//	The VectorFontROM defines characters using arcs and lines.  The HersheyFontROM
@@ -71,6 +200,19 @@
 	#define CFG_IgnoreUndefinedCharacters true			//UNCOMMENT this line and any out-of-bounds/undefined characters will be ignored
 	//#define CFG_IgnoreUndefinedCharacters false		//UNCOMMENT OUT this line and any out-of-bounds/undefined characters print as '~'
 												
+	//=========== Glyph Cache ==============================================
+	//	plotChar() (and so print()) keeps the points of the characters it rasterizes, per font, character, size,
+	//	text density & font spacing.  A character seen before is then added to XY_List as a translated copy of
+	//	those points instead of being worked out again from the font ROM.  When the cache is full the least
+	//	recently used characters are dropped.  Characters taller than 1024 pixels are not cached.
+	//	Off by default: it costs CFG_GlyphCacheBytes + 28 bytes per glyph slot of RAM.  To turn it on, set
+	//	CFG_GlyphCacheBytes to e.g. 8192 (with 64 glyphs, ~10 KB: fine on a TEENSY 3.6; on a DUE take the RAM
+	//	out of CFG_MaxArraySize first, e.g. 2048 bytes & 16 glyphs).
+	#ifndef CFG_GlyphCacheBytes
+		#define CFG_GlyphCacheBytes 0			//RAM for the cached points (4 bytes per point, max 262140); 0 = Off
+	#endif
+	#define CFG_GlyphCacheGlyphs 64			//Characters held at most (each takes 28 bytes more; none when the cache is off)
+
 	//=========== Z-Blank Digital I/O pin Definition =======================
 	//  For DUE running DMA, Pin 2 is MUST be used for DMA clock. CFG_Z_blank_pin can be any pin EXCEPT 2; Pin 3 is asignment typical.
 	// 	For DUE running PIO, any digital pin may be assigned to this function; Pin 3 is the default assignment.
@@ -118,95 +260,26 @@
 													//be unresponsive when plotting large numbers of points
 													
 	//=========== PIO DAC Settling time and Unblank Pulse Width ============	
-	//	F_CPU = TEENSY 3.x ONLY. These values fine tune UNBLANK timing and cope with the relatively slow DAC
-	//	performance of the TEENSY 3.x processors.  These values can also help cope with performance limitations
-	//	that may exist in 'slow O-scopes'. Delay values are specified in 'counts'.  The actual delays achieved
-	//	vary depending on the CPU operating Frequency.  For this reason, the user may make individual adjustments 
-	//	based on CPU operating frequency.  Note: Larger values will increase settling time/increase unblank time.
-	//	Smaller values decreases settling time/unblank time.
+	//	These values fine tune UNBLANK timing and cope with the relatively slow DAC performance of the TEENSY 3.x
+	//	processors.  These values can also help cope with performance limitations that may exist in 'slow O-scopes'.
+	//	Delays are specified in nanoseconds and timed with the CPU cycle counter (DWT CYCCNT), so the same values
+	//	work at every CPU clock speed (F_CPU) and with every compiler version.  Note: Larger values will increase
+	//	settling time/increase unblank time.  Smaller values decreases settling time/unblank time.
 	//
 	//	Note: 	The values below have been set with Vref = 1.5V using a high speed HP1332A XYZ Monitor; 
 	//			These may not be the optimum values when you have Vref = 3.3V or when using a lower speed scope!
 	//
-	#if defined(__SAM3X8E__)	//Defined for use with ARDUINO DUE processor (PIO mode only, Not used for DMA!), 84 Mhz CPU Speed		
-		#define CFG_PioSmallSettleCount 0	//Defines Small Step Settling time delay (where n=Num of NOP instructions)
-		#define CFG_PioLargeSettleCount 0	//Defines Large Step Settling time delay (where n=Num of NOP instructions)
-		#define CFG_PioUnblankCount 0		//Defines UNBLANK Pulse Width (where n=Num of NOP instructions)
+	#if defined(__SAM3X8E__)	//Defined for use with ARDUINO DUE processor (PIO mode only, Not used for DMA!)
+		#define CFG_PioSmallSettleNs 0		//Defines Small Step Settling time delay (ns)
+		#define CFG_PioLargeSettleNs 0		//Defines Large Step Settling time delay (ns)
+		#define CFG_PioUnblankNs 0			//Defines UNBLANK Pulse Width (ns)
 		#define CFG_NoSettlingTimeReqd 200	//Defines Small Step Breakpoint (in DAC counts)
-	#endif
-	
-	#if (F_CPU > 216000000)		//TEENSY - More than 216 Mhz CPU Speed (ie: 240 Mhz)
-		#define CFG_PioSmallSettleCount 25	//Defines Small Step Settling time delay (where n=Num of NOP instructions)
-		#define CFG_PioLargeSettleCount 50	//Defines Large Step Settling time delay (where n=Num of NOP instructions)
-		#define CFG_PioUnblankCount 5		//Defines UNBLANK Pulse Width (where n=Num of NOP instructions)
+	#else						//TEENSY 3.x (and host simulation)
+		#define CFG_PioSmallSettleNs 270	//Defines Small Step Settling time delay (ns)
+		#define CFG_PioLargeSettleNs 500	//Defines Large Step Settling time delay (ns)
+		#define CFG_PioUnblankNs 70			//Defines UNBLANK Pulse Width (ns)
 		#define CFG_NoSettlingTimeReqd 1000	//Defines Small Step Breakpoint (in DAC counts)
 	#endif
-	#if (F_CPU == 216000000)	//TEENSY - 216 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 18
-		#define CFG_PioLargeSettleCount 40
-		#define CFG_PioUnblankCount 5
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU == 192000000)	//TEENSY - 192 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 14
-		#define CFG_PioLargeSettleCount 35
-		#define CFG_PioUnblankCount 5
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU == 180000000)	//TEENSY - 180 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 16
-		#define CFG_PioLargeSettleCount 30
-		#define CFG_PioUnblankCount 4
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif	
-	#if (F_CPU == 168000000)	//TEENSY - 168 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 15
-		#define CFG_PioLargeSettleCount 29
-		#define CFG_PioUnblankCount 3
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif	
-	#if (F_CPU == 144000000)	//TEENSY - 144 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 30
-		#define CFG_PioLargeSettleCount 24
-		#define CFG_PioUnblankCount 2
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-		#if (F_CPU == 120000000)	//120 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 20
-		#define CFG_PioLargeSettleCount 18
-		#define CFG_PioUnblankCount 1
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU == 96000000)			//TEENSY - 96 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 14
-		#define CFG_PioLargeSettleCount 16
-		#define CFG_PioUnblankCount 0
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU == 72000000)			//TEENSY - 72 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 8
-		#define CFG_PioLargeSettleCount 8
-		#define CFG_PioUnblankCount 0
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU == 48000000)			//TEENSY - 48 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 0
-		#define CFG_PioLargeSettleCount 0
-		#define CFG_PioUnblankCount 0
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU == 24000000)			//TEENSY - 24 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 0
-		#define CFG_PioLargeSettleCount 0
-		#define CFG_PioUnblankCount 0
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
-	#if (F_CPU < 24000000)			//TEENSY - Less than 24 Mhz CPU Speed
-		#define CFG_PioSmallSettleCount 0
-		#define CFG_PioLargeSettleCount 0
-		#define CFG_PioUnblankCount 0
-		#define CFG_NoSettlingTimeReqd 1000
-	#endif
 	
 	//=========== TEENSY 3.x Real Time Clock Settings ===================
 	//	